@@ -57,6 +57,10 @@ std::string STRING_J2000;
 std::vector<Int>    MJD_UTC_GPS;
 std::vector<Double> DELTA_UTC_GPS;
 
+/***** RESOURCES *******************************/
+
+Double PREFETCH_MEMORY;
+
 /***** CLASS ***********************************/
 
 // class for constants initialization,
@@ -105,6 +109,8 @@ InitConstants::InitConstants()
     STRING_J2000  = "51544.5";
     J2000         = std::atof(STRING_J2000.c_str());
 
+    PREFETCH_MEMORY = 512;
+
     MJD_UTC_GPS.push_back(date2time(2017, 1, 1).mjdInt());  DELTA_UTC_GPS.push_back(-18);
     MJD_UTC_GPS.push_back(date2time(2015, 7, 1).mjdInt());  DELTA_UTC_GPS.push_back(-17);
     MJD_UTC_GPS.push_back(date2time(2012, 7, 1).mjdInt());  DELTA_UTC_GPS.push_back(-16);
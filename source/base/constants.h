@@ -86,6 +86,10 @@ extern std::string STRING_J2000;   //!< J2000 in mjd
 extern std::vector<Int>    MJD_UTC_GPS;   //!< Time of new introduced leap second.
 extern std::vector<Double> DELTA_UTC_GPS; //!< Leap seconds.
 
+/***** RESOURCES *******************************/
+
+extern Double PREFETCH_MEMORY; //!< Memory budget for reading instrument arcs in background [MB] (0: disabled).
+
 // @} group constants
 
 /***********************************************/
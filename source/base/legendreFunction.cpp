@@ -12,26 +12,15 @@
 */
 /***********************************************/
 
+#include <mutex>
 #include "base/importStd.h"
 #include "base/matrix.h"
 #include "legendreFunction.h"
 
-/***** VARIABLES *******************************/
-
-Matrix LegendreFunction::factor1;
-Matrix LegendreFunction::factor2;
-Matrix LegendreFunction::factor1Integral;
-Matrix LegendreFunction::factor2Integral;
-Vector LegendreFunction::factorSmall; //integration for small thetas
-
 /***********************************************/
 
-void LegendreFunction::computeFactors(UInt degree)
+LegendreFunction::Factors::Factors(UInt degree) : maxDegree(degree)
 {
-  // Enough factors already computed?
-  if(factor1.rows()>degree)
-    return;
-
   factor1 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
   factor2 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
 
@@ -52,12 +41,35 @@ void LegendreFunction::computeFactors(UInt degree)
 
 /***********************************************/
 
-void LegendreFunction::computeFactorsIntegral(UInt degree)
+std::shared_ptr<const LegendreFunction::Factors> LegendreFunction::factors(UInt degree)
+{
+  static std::mutex mutex;
+  static std::shared_ptr<const Factors> table;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if(!table || (table->maxDegree < degree))
+    table = std::make_shared<const Factors>(degree); // tables in use by other threads stay valid
+  return table;
+}
+
+/***********************************************/
+
+// factors for the integral recursion
+class LegendreFunctionIntegralFactors
 {
-  // Enough factors already computed?
-  if(factor1Integral.rows()>degree)
-    return;
+public:
+  UInt   maxDegree;
+  Matrix factor1Integral, factor2Integral;
+  Vector factorSmall; //integration for small thetas
+
+  explicit LegendreFunctionIntegralFactors(UInt degree);
+  static std::shared_ptr<const LegendreFunctionIntegralFactors> get(UInt degree);
+};
+
+/***********************************************/
 
+LegendreFunctionIntegralFactors::LegendreFunctionIntegralFactors(UInt degree) : maxDegree(degree)
+{
   factor1Integral = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
   factor2Integral = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
 
@@ -90,17 +102,40 @@ void LegendreFunction::computeFactorsIntegral(UInt degree)
 
 /***********************************************/
 
+std::shared_ptr<const LegendreFunctionIntegralFactors> LegendreFunctionIntegralFactors::get(UInt degree)
+{
+  static std::mutex mutex;
+  static std::shared_ptr<const LegendreFunctionIntegralFactors> table;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if(!table || (table->maxDegree < degree))
+    table = std::make_shared<const LegendreFunctionIntegralFactors>(degree);
+  return table;
+}
+
+/***********************************************/
+
 const Matrix LegendreFunction::compute(Double t, UInt degree)
 {
-  computeFactors(degree);
+  const auto factors = LegendreFunction::factors(degree);
+  const Matrix &factor1 = factors->factor1;
+  const Matrix &factor2 = factors->factor2;
 
   Matrix Fkt(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
 
-  Fkt(0,0) = 1e280; // dirty trick: to account for small numbers in very high degrees.
-
   // recursion P[n-1][n-1] -> P[n][n] (main diagonals)
+  // with extended exponent range, orders with underflow are computed separately
+  const Double u = sqrt(1-t*t);
+  std::vector<Double> sectoral(degree+1, 1.);
+  std::vector<Int>    exponent(degree+1, 0);
+  Fkt(0,0) = 1.;
   for(UInt n=1; n<=degree; n++)
-    Fkt(n,n) = factor1(n,n) *sqrt(1-t*t)* Fkt(n-1, n-1);
+  {
+    sectoral.at(n) = factor1(n,n) * u * sectoral.at(n-1);
+    exponent.at(n) = exponent.at(n-1);
+    normalizeExtended(&sectoral.at(n), 1, exponent.at(n));
+    Fkt(n,n) = (exponent.at(n)==0) ? sectoral.at(n) : 0.;
+  }
 
   // recursion P[m][n-1] and P[m][n-2] -> P[m][n]
   // secondary diagonal m=n-1
@@ -108,18 +143,27 @@ const Matrix LegendreFunction::compute(Double t, UInt degree)
     Fkt(n,n-1) = factor1(n,n-1) * t * Fkt(n-1,n-1);
 
   // all other functions
-  for(UInt m=0; m<(degree-1); m++)
+  for(UInt m=0; m+1<degree; m++)
     for(UInt n=m+2; n<=degree; n++)
       Fkt(n,m) = factor1(n,m)*t*Fkt(n-1,m) + factor2(n,m)*Fkt(n-2,m);
 
-  return 1e-280 * Fkt; // dirty trick: to account for small numbers in very high degrees.
+  // orders with underflow of the sectorals
+  for(UInt m=0; m<=degree; m++)
+    if(exponent.at(m)!=0)
+      recursionExtended(*factors, m, degree, t, 1., sectoral.at(m), 0., exponent.at(m),
+                        [&](UInt n, Double c, Double /*s*/) {Fkt(n,m) = c;});
+
+  return Fkt;
 }
 
 /***********************************************/
 
 const Matrix LegendreFunction::integral(Double t1, Double t2, UInt degree)
 {
-  computeFactorsIntegral(degree);
+  const auto factors = LegendreFunctionIntegralFactors::get(degree);
+  const Matrix &factor1Integral = factors->factor1Integral;
+  const Matrix &factor2Integral = factors->factor2Integral;
+  const Vector &factorSmall     = factors->factorSmall;
 
   Matrix intP(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
 
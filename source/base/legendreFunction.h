@@ -25,14 +25,43 @@
 * fully normalized. */
 class LegendreFunction
 {
-  static Matrix factor1, factor2;
-  static Matrix factor1Integral, factor2Integral;
-  static Vector factorSmall;
+public:
+  /** @brief Factors of the recursion of fully normalized Legendre functions.
+  * The tables are immutable after construction and can be read by several threads at once. */
+  class Factors
+  {
+  public:
+    explicit Factors(UInt degree);
 
-  static void computeFactors(UInt degree);
-  static void computeFactorsIntegral(UInt degree);
+    UInt   maxDegree;
+    Matrix factor1; //!< recursion P[n-1][m], P[n-2][m] -> P[n][m] and P[n-1][n-1] -> P[n][n] (lower triangular)
+    Matrix factor2; //!< recursion P[n-1][m], P[n-2][m] -> P[n][m] (lower triangular)
+  };
+
+  /** @brief Shared recursion factors up to at least @a degree.
+  * The tables are computed only once per process (extended if a higher degree is requested).
+  * Thread safe: the returned tables are never modified, a larger request creates new tables. */
+  static std::shared_ptr<const Factors> factors(UInt degree);
+
+  /** @brief Normalization of numbers with extended exponent range (X-numbers).
+  * The values @a x with the common exponent @a i represent @f$ x\cdot 2^{960i} @f$.
+  * After normalization the largest value is within @f$ [10^{-280}, 10^{144}) @f$ (or all values are zero),
+  * the lower bound leaves room for the recursions in plain Double arithmetic. */
+  static inline void normalizeExtended(Double *x, UInt count, Int &i);
+
+  /** @brief Double value of a number with extended exponent range (underflow results in zero). */
+  static Double extended2Double(Double x, Int i) {return (i==0) ? x : ((i<-1) ? 0. : std::ldexp(x, 960*i));}
+
+  /** @brief Recursion of one order @a m with extended exponent range.
+  * Computes a pair of functions (e.g. the cos and sin part of solid spherical harmonics)
+  * @f[ C_{n,m} = f^1_{n,m}\,z\,C_{n-1,m} + f^2_{n,m}\,r^2\,C_{n-2,m},\quad n=m+1\ldots\textnormal{degree} @f]
+  * starting from the sectorals @a c, @a s with the exponent @a i.
+  * Each result is returned as Double with @a store(n, c, s).
+  * Used for the orders where the sectorals underflow (near the poles in very high degrees),
+  * continues with plain Double arithmetic as soon as the values are representable. */
+  template<typename Store>
+  static void recursionExtended(const Factors &factors, UInt m, UInt degree, Double z, Double rr, Double c, Double s, Int i, Store store);
 
-public:
   /** @brief Legendre functions.
   * (fully normalized).
   * @f[ P_n^m(t) \textnormal{ with } t=\cos(\psi),\quad n,m=0\ldots\textnormal{degree} @f]
@@ -50,6 +79,54 @@ public:
 
 /***********************************************/
 
+inline void LegendreFunction::normalizeExtended(Double *x, UInt count, Int &i)
+{
+  Double w = 0;
+  for(UInt k=0; k<count; k++)
+    w = std::max(w, std::fabs(x[k]));
+  while(w >= 1e144)
+  {
+    w = std::ldexp(w, -960);
+    for(UInt k=0; k<count; k++)
+      x[k] = std::ldexp(x[k], -960);
+    i++;
+  }
+  while((w < 1e-280) && (w > 0))
+  {
+    w = std::ldexp(w, 960);
+    for(UInt k=0; k<count; k++)
+      x[k] = std::ldexp(x[k], 960);
+    i--;
+  }
+}
+
+/***********************************************/
+
+template<typename Store>
+void LegendreFunction::recursionExtended(const Factors &factors, UInt m, UInt degree, Double z, Double rr, Double c, Double s, Int i, Store store)
+{
+  Double x[4] = {c, s, 0., 0.}; // C(n-1,m), S(n-1,m), C(n-2,m), S(n-2,m) with common exponent
+  normalizeExtended(x, 2, i);
+  store(m, extended2Double(x[0], i), extended2Double(x[1], i));
+  for(UInt n=m+1; n<=degree; n++)
+  {
+    const Double f1 = factors.factor1(n,m) * z;
+    const Double f2 = factors.factor2(n,m) * rr; // zero for n=m+1
+    const Double cn = f1 * x[0] + f2 * x[2];
+    const Double sn = f1 * x[1] + f2 * x[3];
+    x[2] = x[0]; x[3] = x[1];
+    x[0] = cn;   x[1] = sn;
+    if(i!=0)
+      normalizeExtended(x, 4, i);
+    if(i==0)
+      store(n, x[0], x[1]);
+    else if(i==-1)
+      store(n, extended2Double(x[0], i), extended2Double(x[1], i));
+  }
+}
+
+/***********************************************/
+
 #endif /* __LEGENDREFUNCTION__ */
 
 
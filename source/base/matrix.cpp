@@ -12,6 +12,11 @@
 */
 /***********************************************/
 
+#include <atomic>
+#include <cstdlib>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 #include "base/importStd.h"
 #include "base/constants.h"
 #include "external/lapack/blas.h"
@@ -22,11 +27,130 @@
 /***** MatrixBase ******************************/
 /***********************************************/
 
+namespace
+{
+  constexpr UInt minPoolClass     = 4;       // 16 elements
+  constexpr UInt maxPoolClass     = 16;      // 512 kB, larger fields are allocated directly
+  constexpr UInt maxPoolPerClass  = 16;      // cached fields per size class
+  constexpr UInt hugePageSize     = 2097152; // bytes
+
+  // fields released within a scope, per thread
+  class MatrixPool
+  {
+  public:
+    UInt scopeCount = 0;
+    std::vector<std::vector<Double*>> fields = std::vector<std::vector<Double*>>(maxPoolClass+1);
+
+    ~MatrixPool()
+    {
+      for(auto &list : fields)
+        for(Double *field : list)
+          delete[] field;
+    }
+  };
+
+  // plain pointer: no destruction order problems at thread exit
+  thread_local MatrixPool *pool = nullptr;
+
+  std::atomic<UInt> countAllocations(0);
+  std::atomic<UInt> countAllocationsPool(0);
+  std::atomic<UInt> countBytes(0);
+}
+
+/***********************************************/
+
+MatrixBase::PoolScope::PoolScope()
+{
+  if(!pool)
+    pool = new MatrixPool();
+  pool->scopeCount++;
+}
+
+/***********************************************/
+
+MatrixBase::PoolScope::~PoolScope()
+{
+  if(--pool->scopeCount == 0)
+  {
+    delete pool;
+    pool = nullptr;
+  }
+}
+
+/***********************************************/
+
+MatrixBase::Statistics MatrixBase::statistics()
+{
+  Statistics stat;
+  stat.allocations     = countAllocations;
+  stat.allocationsPool = countAllocationsPool;
+  stat.bytes           = countBytes;
+  return stat;
+}
+
+/***********************************************/
+
+std::shared_ptr<Double> MatrixBase::allocate(UInt size)
+{
+  try
+  {
+    countAllocations++;
+    countBytes += size*sizeof(Double);
+
+    // size class
+    UInt idClass = minPoolClass;
+    while((idClass <= maxPoolClass) && ((UInt(1)<<idClass) < size))
+      idClass++;
+
+    if(pool && (idClass <= maxPoolClass))
+    {
+      Double *field = nullptr;
+      if(pool->fields.at(idClass).size())
+      {
+        field = pool->fields.at(idClass).back();
+        pool->fields.at(idClass).pop_back();
+        countAllocationsPool++;
+      }
+      else
+        field = new Double[UInt(1)<<idClass];
+      return std::shared_ptr<Double>(field, [idClass](Double *field)
+      {
+        if(pool && (pool->fields.at(idClass).size() < maxPoolPerClass))
+          pool->fields.at(idClass).push_back(field);
+        else
+          delete[] field;
+      });
+    }
+
+#ifdef __linux__
+    // large fields within a pool scope: transparent huge pages
+    if(pool && (size*sizeof(Double) >= 4*hugePageSize))
+    {
+      void *field = nullptr;
+      const UInt bytes = (size*sizeof(Double)+hugePageSize-1)/hugePageSize*hugePageSize;
+      if(posix_memalign(&field, hugePageSize, bytes) == 0)
+      {
+        madvise(field, bytes, MADV_HUGEPAGE);
+        return std::shared_ptr<Double>(static_cast<Double*>(field), [](Double *field) {std::free(field);});
+      }
+    }
+#endif
+
+    return std::shared_ptr<Double>(new Double[size], std::default_delete<Double[]>());
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 MatrixBase::MatrixBase(UInt size) : _size(size)
 {
   try
   {
-    ptr = std::shared_ptr<Double>(new Double[_size], std::default_delete<Double[]>());
+    ptr = allocate(_size);
   }
   catch(std::exception &e)
   {
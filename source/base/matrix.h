@@ -658,6 +658,45 @@ class MatrixBase
 public:
   explicit MatrixBase(UInt size);  //!< Constructor
 
+  /** @brief Reuse of matrix memory in the current thread within the lifetime of this object.
+  * Released memory is kept in a pool of size classes (powers of two) and is reused by new matrices.
+  * At the end of the (outermost) scope all pooled memory is released at once.
+  * Larger fields allocated within the scope are backed by transparent huge pages (Linux).
+  * Intended for loops with many temporary matrices of similar size (e.g. observation equations of arcs).
+  * @code
+  * {
+  *   MatrixBase::PoolScope poolScope;
+  *   for(UInt arcNo=0; arcNo<arcCount; arcNo++)
+  *     ... // temporary matrices
+  * } // memory released
+  * @endcode */
+  class PoolScope
+  {
+  public:
+    PoolScope();
+    ~PoolScope();
+    PoolScope(const PoolScope &) = delete;
+    PoolScope &operator=(const PoolScope &) = delete;
+  };
+
+  /** @brief Counters of memory allocations of all matrices (all threads). */
+  class Statistics
+  {
+  public:
+    UInt allocations;     //!< number of allocated memory fields
+    UInt allocationsPool; //!< number of fields reused from pool (see @a PoolScope)
+    UInt bytes;           //!< allocated bytes
+
+    Statistics operator-(const Statistics &x) const {return Statistics{allocations-x.allocations, allocationsPool-x.allocationsPool, bytes-x.bytes};}
+  };
+
+  /** @brief Counters of memory allocations since program start. */
+  static Statistics statistics();
+
+  /** @brief Allocate memory field for @p size elements.
+  * Within @a PoolScope memory is taken from pool and large fields are backed by huge pages if available. */
+  static std::shared_ptr<Double> allocate(UInt size);
+
   /// count of elements in field.
   UInt size() const {return _size;}
 
@@ -683,7 +722,7 @@ inline Double *MatrixBase::field()
 {
   if(ptr.use_count()>1) // not threat save
   {
-    auto ptr2 = std::shared_ptr<Double>(new Double[size()], std::default_delete<Double[]>());
+    auto ptr2 = allocate(size());
     std::copy_n(ptr.get(), size(), ptr2.get());
     std::swap(ptr, ptr2);
   }
@@ -0,0 +1,505 @@
+/***********************************************/
+/**
+* @file matrixPacked.cpp
+*
+* @brief Symmetric and triangular matrices in rectangular full packed format (RFP).
+*
+* @date 2026-10-17
+*
+*/
+/***********************************************/
+
+#include "base/importStd.h"
+#include "base/constants.h"
+#include "external/lapack/lapack.h"
+#include "base/matrixPacked.h"
+
+/***********************************************/
+
+// copy only the used triangle of a diagonal block
+static void copyTriangle(const_MatrixSliceRef A, MatrixSliceRef B, Bool isUpper)
+{
+  for(UInt s=0; s<B.columns(); s++)
+    for(UInt z=(isUpper ? 0 : s); z<(isUpper ? s+1 : B.rows()); z++)
+      B(z,s) = A(z,s);
+}
+
+/***********************************************/
+
+MatrixPacked::MatrixPacked(UInt rows, Matrix::Type type, Matrix::Uplo uplo)
+{
+  try
+  {
+    init(rows, type, uplo);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+MatrixPacked::MatrixPacked(const_MatrixSliceRef A)
+{
+  try
+  {
+    if(A.rows() != A.columns())
+      throw(Exception("Dimension error: ("+A.rows()%"%i x "s+A.columns()%"%i)"s));
+    init(A.rows(), A.getType(), A.isUpper() ? Matrix::UPPER : Matrix::LOWER);
+
+    const UInt n1 = blockSize(0);
+    const UInt n2 = blockSize(1);
+    copyTriangle(A.slice(0, 0, n1, n1), block(0,0), isUpper());
+    copyTriangle(A.slice(n1, n1, n2, n2), block(1,1), isUpper());
+    if(isUpper())
+      copy(A.slice(0, n1, n1, n2), block(0,1));
+    else
+      copy(A.slice(n1, 0, n2, n1), block(1,0));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void MatrixPacked::init(UInt rows, Matrix::Type type, Matrix::Uplo uplo)
+{
+  if(type == Matrix::GENERAL)
+    throw(Exception("Matrix must be SYMMETRIC or TRIANGULAR"));
+  _rows  = rows;
+  _type  = type;
+  _uplo  = uplo;
+  _rows1 = (uplo == Matrix::UPPER) ? (rows/2) : ((rows+1)/2);
+  _rfp   = (rows == 0) ? Matrix() : Matrix(((rows%2) ? rows : rows+1), (rows+1)/2);
+}
+
+/***********************************************/
+
+void MatrixPacked::setType(Matrix::Type type)
+{
+  if(type == Matrix::GENERAL)
+    throw(Exception("Matrix must be SYMMETRIC or TRIANGULAR"));
+  _type = type;
+}
+
+/***********************************************/
+
+// RFP with TRANSR='N' (see LAPACK dpftrf)
+// UPPER: (n/2 x n/2) upper triangle A11 transposed below A22, A12 on top
+// LOWER: ((n+1)/2 x (n+1)/2) lower triangle A11, A21 below, A22 transposed on top
+UInt MatrixPacked::index(UInt row, UInt column) const
+{
+  const UInt ld  = _rfp.rows();
+  const UInt off = (_rows%2) ? 0 : 1;
+  if(isUpper())
+  {
+    if(column >= _rows1)
+      return row + (column-_rows1)*ld;
+    return (column+_rows1+1) + row*ld;
+  }
+  if(column < _rows1)
+    return (row+off) + column*ld;
+  return (column-_rows1) + (row-_rows1+1-off)*ld;
+}
+
+/***********************************************/
+
+Double MatrixPacked::operator()(UInt row, UInt column) const
+{
+  if((row >= _rows) || (column >= _rows))
+    throw(Exception("Access to matrix element ("s+row%"%i x "s+column%"%i) out of range, matrix size ("s+_rows%"%i x "s+_rows%"%i)"s));
+  if((isUpper() && (row > column)) || (!isUpper() && (row < column)))
+  {
+    if(_type == Matrix::TRIANGULAR)
+      return 0.;
+    std::swap(row, column);
+  }
+  return field()[index(row, column)];
+}
+
+/***********************************************/
+
+Double &MatrixPacked::operator()(UInt row, UInt column)
+{
+  if((row >= _rows) || (column >= _rows))
+    throw(Exception("Access to matrix element ("s+row%"%i x "s+column%"%i) out of range, matrix size ("s+_rows%"%i x "s+_rows%"%i)"s));
+  if((isUpper() && (row > column)) || (!isUpper() && (row < column)))
+  {
+    if(_type == Matrix::TRIANGULAR)
+      throw(Exception("Access to element ("s+row%"%i x "s+column%"%i) outside the triangle"s));
+    std::swap(row, column);
+  }
+  return field()[index(row, column)];
+}
+
+/***********************************************/
+
+MatrixSlice MatrixPacked::view(UInt i, UInt k) const
+{
+  try
+  {
+    const UInt n1  = blockSize(0);
+    const UInt n2  = blockSize(1);
+    const UInt off = (_rows%2) ? 0 : 1;
+    if(isUpper())
+    {
+      if((i==0) && (k==0))
+      {
+        MatrixSlice A(_rfp.slice(n1+1, 0, n1, n1));
+        A.setType(_type, Matrix::LOWER);
+        return A.trans();
+      }
+      if((i==0) && (k==1))
+        return MatrixSlice(_rfp.slice(0, 0, n1, n2));
+      if((i==1) && (k==1))
+      {
+        MatrixSlice A(_rfp.slice(n1, 0, n2, n2));
+        A.setType(_type, Matrix::UPPER);
+        return A;
+      }
+    }
+    else
+    {
+      if((i==0) && (k==0))
+      {
+        MatrixSlice A(_rfp.slice(off, 0, n1, n1));
+        A.setType(_type, Matrix::LOWER);
+        return A;
+      }
+      if((i==1) && (k==0))
+        return MatrixSlice(_rfp.slice(n1+off, 0, n2, n1));
+      if((i==1) && (k==1))
+      {
+        MatrixSlice A(_rfp.slice(0, 1-off, n2, n2));
+        A.setType(_type, Matrix::UPPER);
+        return A.trans();
+      }
+    }
+    throw(Exception("block("+i%"%i, "s+k%"%i) is not stored"s));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+const_MatrixSlice MatrixPacked::block(UInt i, UInt k) const
+{
+  return view(i, k);
+}
+
+/***********************************************/
+
+MatrixSlice MatrixPacked::block(UInt i, UInt k)
+{
+  if(_rfp.size())
+    _rfp.field(); // copy on write
+  return view(i, k);
+}
+
+/***********************************************/
+
+Matrix MatrixPacked::full() const
+{
+  try
+  {
+    const UInt n1 = blockSize(0);
+    const UInt n2 = blockSize(1);
+    Matrix A(_rows, _type, _uplo);
+    copyTriangle(block(0,0), A.slice(0, 0, n1, n1), isUpper());
+    copyTriangle(block(1,1), A.slice(n1, n1, n2, n2), isUpper());
+    if(isUpper())
+      copy(block(0,1), A.slice(0, n1, n1, n2));
+    else
+      copy(block(1,0), A.slice(n1, 0, n2, n1));
+    return A;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix MatrixPacked::slice(UInt startRow, UInt startColumn, UInt height, UInt width) const
+{
+  try
+  {
+    if((startRow+height>rows()) || (startColumn+width>columns()))
+      throw(Exception("Dimension error: ("+rows()%"%i x "s+columns()%"%i).slice("s+startRow%"%i, "s+startColumn%"%i, "s+height%"%i, "s+width%"%i)"s));
+    Matrix A(height, width);
+    for(UInt s=0; s<width; s++)
+      for(UInt z=0; z<height; z++)
+        A(z,s) = operator()(startRow+z, startColumn+s);
+    return A;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+/***********************************************/
+
+void matMult(Double c, const MatrixPacked &A, const_MatrixSliceRef B, MatrixSliceRef C)
+{
+  try
+  {
+    if((A.columns()!=B.rows()) || (A.rows()!=C.rows()) || (B.columns()!=C.columns()))
+      throw(Exception("Dimension error"));
+    if(A.rows()==0)
+      return;
+
+    const UInt n1 = A.blockSize(0);
+    const UInt n2 = A.blockSize(1);
+    if(n1)
+      matMult(c, A.block(0,0), B.row(0, n1), C.row(0, n1));
+    if(n2)
+      matMult(c, A.block(1,1), B.row(n1, n2), C.row(n1, n2));
+    if(n1 && n2)
+    {
+      const const_MatrixSlice A12 = A.isUpper() ? A.block(0,1) : A.block(1,0).trans();
+      if((A.getType() == Matrix::SYMMETRIC) || A.isUpper())
+        matMult(c, A12, B.row(n1, n2), C.row(0, n1));
+      if((A.getType() == Matrix::SYMMETRIC) || !A.isUpper())
+        matMult(c, A12.trans(), B.row(0, n1), C.row(n1, n2));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("C("s+C.rows()%"%i x "s+C.columns()%"%i) = A("s+A.rows()%"%i x "s+A.columns()%"%i) * B("s+B.rows()%"%i x "s+B.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
+
+void rankKUpdate(Double c, const_MatrixSliceRef A, MatrixPacked &N)
+{
+  try
+  {
+    if(A.columns()!=N.rows())
+      throw(Exception("Dimension error"));
+    if((N.rows()==0) || (A.size()==0))
+      return;
+    if(N.getType()!=Matrix::SYMMETRIC)
+      throw(Exception("Matrix N must be SYMMETRIC"));
+
+    const UInt n1 = N.blockSize(0);
+    const UInt n2 = N.blockSize(1);
+    if(n1)
+      rankKUpdate(c, A.column(0, n1), N.block(0,0));
+    if(n2)
+      rankKUpdate(c, A.column(n1, n2), N.block(1,1));
+    if(n1 && n2 && N.isUpper())
+      matMult(c, A.column(0, n1).trans(), A.column(n1, n2), N.block(0,1));
+    if(n1 && n2 && !N.isUpper())
+      matMult(c, A.column(n1, n2).trans(), A.column(0, n1), N.block(1,0));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("N = A'A mit A = ("s+A.rows()%"%i x "s+A.columns()%"%i) and N = ("s+N.rows()%"%i x "s+N.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
+
+void cholesky(MatrixPacked &N)
+{
+  try
+  {
+    if(N.getType()!=Matrix::SYMMETRIC)
+      throw(Exception("Matrix must be SYMMETRIC"));
+    N.setType(Matrix::TRIANGULAR);
+    if(N.rows()==0)
+      return;
+
+    const Int info = lapack_dpftrf(N.isUpper(), N.rows(), N.field());
+    if(info!=0)
+      throw(Exception("cannot compute decomposition, error = "+info%"%i"s));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("W'W = A("s+N.rows()%"%i x "s+N.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
+
+void cholesky2Inverse(MatrixPacked &W)
+{
+  try
+  {
+    if(W.getType()!=Matrix::TRIANGULAR)
+      throw(Exception("Matrix must be TRIANGULAR"));
+    W.setType(Matrix::SYMMETRIC);
+    if(W.rows()==0)
+      return;
+
+    const Int info = lapack_dpftri(W.isUpper(), W.rows(), W.field());
+    if(info!=0)
+      throw(Exception("can not compute inverse, error = "+info%"%i"s));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("A = ("s+W.rows()%"%i x "s+W.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
+
+void inverse(MatrixPacked &A)
+{
+  try
+  {
+    if(A.rows()==0)
+      return;
+
+    if(A.getType()==Matrix::SYMMETRIC)
+    {
+      cholesky(A);
+      cholesky2Inverse(A);
+      return;
+    }
+
+    const Int info = lapack_dtftri(A.isUpper(), A.rows(), A.field());
+    if(info!=0)
+      throw(Exception("can not compute inverse, error = "+info%"%i"s));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("A = ("s+A.rows()%"%i x "s+A.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
+
+// C := c * W^-1 * C with W = [W11 W12; 0 W22] (upper) or W = [W11 0; W21 W22] (lower)
+static void triangularSolve(Double c, const_MatrixSliceRef W11, const_MatrixSliceRef Woff, const_MatrixSliceRef W22, Bool isUpper, MatrixSliceRef C)
+{
+  const UInt n1 = W11.rows();
+  const UInt n2 = W22.rows();
+  if(!n1 || !n2)
+  {
+    triangularSolve(c, (n1 ? W11 : W22), C);
+    return;
+  }
+  if(isUpper)
+  {
+    triangularSolve(c, W22, C.row(n1, n2));
+    C.row(0, n1) *= c;
+    matMult(-1., Woff, C.row(n1, n2), C.row(0, n1));
+    triangularSolve(1., W11, C.row(0, n1));
+  }
+  else
+  {
+    triangularSolve(c, W11, C.row(0, n1));
+    C.row(n1, n2) *= c;
+    matMult(-1., Woff, C.row(0, n1), C.row(n1, n2));
+    triangularSolve(1., W22, C.row(n1, n2));
+  }
+}
+
+/***********************************************/
+
+void triangularSolve(Double c, const MatrixPacked &W, MatrixSliceRef C)
+{
+  try
+  {
+    if(W.getType()!=Matrix::TRIANGULAR)
+      throw(Exception("Matrix W must be TRIANGULAR"));
+    if(W.columns()!=C.rows())
+      throw(Exception("Dimension error"));
+    if(W.rows()==0)
+      return;
+
+    triangularSolve(c, W.block(0,0), W.isUpper() ? W.block(0,1) : W.block(1,0), W.block(1,1), W.isUpper(), C);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("B = A("s+W.rows()%"%i x "s+W.columns()%"%i)^-1 * B("s+C.rows()%"%i x "s+C.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
+
+void triangularTransSolve(Double c, const MatrixPacked &W, MatrixSliceRef C)
+{
+  try
+  {
+    if(W.getType()!=Matrix::TRIANGULAR)
+      throw(Exception("Matrix W must be TRIANGULAR"));
+    if(W.columns()!=C.rows())
+      throw(Exception("Dimension error"));
+    if(W.rows()==0)
+      return;
+
+    // W^T = [W11^T 0; W12^T W22^T] (upper) or [W11^T W21^T; 0 W22^T] (lower)
+    triangularSolve(c, W.block(0,0).trans(), W.isUpper() ? W.block(0,1).trans() : W.block(1,0).trans(), W.block(1,1).trans(), !W.isUpper(), C);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("B = A("s+W.rows()%"%i x "s+W.columns()%"%i)^-T * B("s+C.rows()%"%i x "s+C.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
+
+void solveInPlace(MatrixPacked &N, MatrixSliceRef B)
+{
+  try
+  {
+    if(N.columns()!=B.rows())
+      throw(Exception("Dimension error"));
+    if((N.rows()==0) || (B.size()==0))
+      return;
+
+    if(N.getType()==Matrix::TRIANGULAR)
+    {
+      triangularSolve(1., N, B);
+      return;
+    }
+
+    cholesky(N);
+    if(!B.isRowMajorOrder())
+    {
+      const Int info = lapack_dpftrs(N.isUpper(), N.rows(), B.columns(), N.field(), B.field(), B.ld());
+      if(info!=0)
+        throw(Exception("cannot solve, error = "+info%"%i"s));
+      return;
+    }
+    Matrix B2 = B;
+    const Int info = lapack_dpftrs(N.isUpper(), N.rows(), B2.columns(), N.field(), B2.field(), B2.ld());
+    if(info!=0)
+      throw(Exception("cannot solve, error = "+info%"%i"s));
+    copy(B2, B);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW_EXTRA("N("s+N.rows()%"%i x "s+N.columns()%"%i)^-1 * B("s+B.rows()%"%i x "s+B.columns()%"%i)"s, e)
+  }
+}
+
+/***********************************************/
+
+Matrix solve(MatrixPacked &N, const_MatrixSliceRef B)
+{
+  try
+  {
+    Matrix X = B;
+    solveInPlace(N, X);
+    return X;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
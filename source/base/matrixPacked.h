@@ -0,0 +1,157 @@
+/***********************************************/
+/**
+* @file matrixPacked.h
+*
+* @brief Symmetric and triangular matrices in rectangular full packed format (RFP).
+*
+* @date 2026-10-17
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_MATRIXPACKED__
+#define __GROOPS_MATRIXPACKED__
+
+#include "base/matrix.h"
+
+/** @addtogroup matrixGroup */
+/// @{
+
+/***** CLASS ***********************************/
+
+/** @brief Symmetric or triangular matrix in rectangular full packed format (RFP).
+* Only the used triangle is stored, the memory consumption is n(n+1)/2 instead of n^2.
+* The matrix is divided into 2x2 blocks. The diagonal blocks (as triangles) and the off diagonal
+* block (as rectangle) are stored in one (column major) rectangular Matrix (LAPACK RFP with TRANSR='N').
+* The blocks are accessible as views (@a block) and can be used in all Matrix operations.
+*
+* For UPPER matrices the off diagonal block is block(0,1), for LOWER matrices block(1,0).
+* @code
+* MatrixPacked N(A.columns());
+* rankKUpdate(1., A, N); // N += A^T A
+* solveInPlace(N, n);    // n := N^-1 n
+* @endcode */
+class MatrixPacked
+{
+public:
+  /** @brief Constructor (all elements are zero).
+  * @param rows Number of rows and columns.
+  * @param type SYMMETRIC or TRIANGULAR
+  * @param uplo which triangle is stored */
+  explicit MatrixPacked(UInt rows=0, Matrix::Type type=Matrix::SYMMETRIC, Matrix::Uplo uplo=Matrix::UPPER);
+
+  /** @brief Packs the used triangle of @a A.
+  * @a A must be SYMMETRIC or TRIANGULAR. */
+  explicit MatrixPacked(const_MatrixSliceRef A);
+
+  UInt rows()    const {return _rows;}               //!< row count.
+  UInt columns() const {return _rows;}               //!< column count.
+  UInt size()    const {return _rows*(_rows+1)/2;}   //!< number of stored elements.
+  Matrix::Type getType() const {return _type;}       //!< SYMMETRIC or TRIANGULAR.
+  Bool isUpper() const {return _uplo==Matrix::UPPER;} //!< Is the upper triangle stored?
+
+  /** @brief Set type of the matrix (SYMMETRIC or TRIANGULAR). */
+  void setType(Matrix::Type type);
+
+  /** @brief Matrix element.
+  * For TRIANGULAR matrices the element of the other triangle is zero. */
+  Double operator()(UInt row, UInt column) const;
+
+  /** @brief Writable matrix element.
+  * For SYMMETRIC matrices both triangles refer to the same element.
+  * Must be in the used triangle for TRIANGULAR matrices. */
+  Double &operator()(UInt row, UInt column);
+
+  /** @brief Size of the diagonal blocks (@p i = 0,1). */
+  UInt blockSize(UInt i) const {return (i==0) ? _rows1 : _rows-_rows1;}
+
+  /** @brief Start index of the diagonal blocks (@p i = 0,1). */
+  UInt blockIndex(UInt i) const {return (i==0) ? 0 : _rows1;}
+
+  /** @brief Readonly view of a block.
+  * Diagonal blocks are SYMMETRIC or TRIANGULAR, the off diagonal block is block(0,1) for UPPER
+  * and block(1,0) for LOWER matrices. */
+  const_MatrixSlice block(UInt i, UInt k) const;
+
+  /** @brief Writable view of a block.
+  * Diagonal blocks are SYMMETRIC or TRIANGULAR, the off diagonal block is block(0,1) for UPPER
+  * and block(1,0) for LOWER matrices. */
+  MatrixSlice block(UInt i, UInt k);
+
+  /** @brief Unpacked matrix with the same type. */
+  Matrix full() const;
+
+  /** @brief Copy of a submatrix (GENERAL).
+  * For SYMMETRIC matrices both triangles are filled, for TRIANGULAR matrices the other triangle is zero. */
+  Matrix slice(UInt startRow, UInt startColumn, UInt height, UInt width) const;
+
+  /** @brief Pointer to the RFP memory (LAPACK with TRANSR='N'). */
+  const Double *field() const {return static_cast<const const_MatrixSlice&>(_rfp).field();}
+
+  /** @brief Pointer to the RFP memory (LAPACK with TRANSR='N'). */
+  Double *field() {return _rfp.field();}
+
+  /** @brief Position of the element in the RFP memory.
+  * The element must be in the stored triangle. */
+  UInt index(UInt row, UInt column) const;
+
+  void setNull() {_rfp.setNull();} //!< reset all matrix elements.
+
+  MatrixPacked &operator*=(Double c) {_rfp *= c; return *this;} //!< scale all matrix elements.
+
+private:
+  UInt         _rows, _rows1;
+  Matrix::Type _type;
+  Matrix::Uplo _uplo;
+  Matrix       _rfp;
+
+  void init(UInt rows, Matrix::Type type, Matrix::Uplo uplo);
+  MatrixSlice view(UInt i, UInt k) const;
+};
+
+/***** FUNCTIONS *******************************/
+
+/** @brief Matrix matrix multiplication: C += c * A * B.
+* The @a type of @a A is considered. */
+void matMult(Double c, const MatrixPacked &A, const_MatrixSliceRef B, MatrixSliceRef C);
+
+/** @brief rank k update (accumulate normal equations).
+* @a N must be SYMMETRIC.
+* @f[ N += c \cdot (A^TA) @f] */
+void rankKUpdate(Double c, const_MatrixSliceRef A, MatrixPacked &N);
+
+/** @brief Cholesky decomposition of a SYMMETRIC matrix.
+* Output: triangular matrix, @f$ N = W^TW @f$ for UPPER matrices and @f$ N = LL^T @f$ for LOWER matrices. */
+void cholesky(MatrixPacked &N);
+
+/** @brief Inverte a matrix, if the cholesky decomposition of the matrix is given. */
+void cholesky2Inverse(MatrixPacked &W);
+
+/** @brief Inverte a SYMMETRIC or TRIANGULAR matrix. */
+void inverse(MatrixPacked &A);
+
+/** @brief Inverse triangular matrix - matrix multiplication: C := c * W^-1 * C.
+* W must be a TRIANGULAR matrix. */
+void triangularSolve(Double c, const MatrixPacked &W, MatrixSliceRef C);
+
+/** @brief Inverse transposed triangular matrix - matrix multiplication: C := c * W^-T * C.
+* W must be a TRIANGULAR matrix. */
+void triangularTransSolve(Double c, const MatrixPacked &W, MatrixSliceRef C);
+
+/** @brief Solve system of equations for mutliple right hand sides.
+* @f[ B := N^{-1} B @f]
+* - if @a N is SYMMETRIC content will be replaced by the cholesky decomposition.
+* - if @a N is TRIANGULAR content is unchanged. */
+void solveInPlace(MatrixPacked &N, MatrixSliceRef B);
+
+/** @brief Solve system of equations for mutliple right hand sides.
+* @f[ B := N^{-1} B @f]
+* - if @a N is SYMMETRIC content will be replaced by the cholesky decomposition.
+* - if @a N is TRIANGULAR content is unchanged. */
+Matrix solve(MatrixPacked &N, const_MatrixSliceRef B);
+
+/// @}
+
+/***********************************************/
+
+#endif /* __GROOPS_MATRIXPACKED__ */
@@ -0,0 +1,303 @@
+/***********************************************/
+/**
+* @file matrixSmall.h
+*
+* @brief Small matrices with fixed capacity on the stack.
+*
+* @date 2026-10-17
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_MATRIXSMALL__
+#define __GROOPS_MATRIXSMALL__
+
+#include "base/matrix.h"
+
+/** @addtogroup matrixGroup */
+/// @{
+
+/***** CLASS ***********************************/
+
+/** @brief Small dense matrix with fixed capacity.
+* The elements are stored in column major order on the stack, so no heap allocation is needed.
+* The actual size can be any value up to the capacity given as template parameters.
+* Intended for the many tiny operations per observation (a few rows, some tens of columns),
+* where the call overhead of BLAS/LAPACK and the allocations dominate the arithmetic.
+* For larger sizes use @a Matrix.
+* @code
+* if(MatrixSmall<32,4>::fits(B.rows(), B.columns()) && MatrixSmall<32,64>::fits(A.rows(), A.columns()))
+* {
+*   MatrixSmall<32,4>  Bs(B);
+*   MatrixSmall<32,64> As(A);
+*   eliminationParameter(Bs, As);
+*   A = As.matrix();
+* }
+* @endcode */
+template<UInt MAXROWS, UInt MAXCOLUMNS>
+class MatrixSmall
+{
+  UInt   rows_, columns_;
+  Double field_[MAXROWS*MAXCOLUMNS];
+
+public:
+  /** @brief Constructor (all elements are zero). */
+  explicit MatrixSmall(UInt rows=0, UInt columns=0) : rows_(rows), columns_(columns)
+  {
+    if(!fits(rows, columns))
+      throw(Exception("MatrixSmall("s+rows%"%i x "s+columns%"%i) exceeds capacity ("s+MAXROWS%"%i x "s+MAXCOLUMNS%"%i)"s));
+    std::fill_n(field_, MAXROWS*columns, 0.);
+  }
+
+  /** @brief Copy of a (GENERAL) matrix. */
+  explicit MatrixSmall(const_MatrixSliceRef A) : MatrixSmall(A.rows(), A.columns()) {copy(A, 0, 0);}
+
+  /** @brief Does a matrix with the given size fit into the capacity? */
+  static constexpr Bool fits(UInt rows, UInt columns) {return (rows <= MAXROWS) && (columns <= MAXCOLUMNS);}
+
+  UInt rows()    const {return rows_;}    //!< Number of rows.
+  UInt columns() const {return columns_;} //!< Number of columns.
+
+  Double &operator()(UInt row, UInt column)       {return field_[row+MAXROWS*column];} //!< Element (without range check).
+  Double  operator()(UInt row, UInt column) const {return field_[row+MAXROWS*column];} //!< Element (without range check).
+
+  /** @brief Pointer to the first element of a column (elements of a column are contiguous). */
+  Double       *column(UInt column)       {return field_+MAXROWS*column;}
+  const Double *column(UInt column) const {return field_+MAXROWS*column;}
+
+  /** @brief Copy a (GENERAL) matrix into this at position (@a row, @a column). */
+  void copy(const_MatrixSliceRef A, UInt row, UInt column)
+  {
+    if((row+A.rows() > rows_) || (column+A.columns() > columns_))
+      throw(Exception("Dimension error: MatrixSmall("s+rows_%"%i x "s+columns_%"%i), A("s+A.rows()%"%i x "s+A.columns()%"%i) at ("s+row%"%i, "s+column%"%i)"s));
+    const UInt strideRow    = A.isRowMajorOrder() ? A.ld() : 1;
+    const UInt strideColumn = A.isRowMajorOrder() ? 1 : A.ld();
+    for(UInt k=0; k<A.columns(); k++)
+    {
+      const Double *a = A.field() + k*strideColumn;
+      Double       *c = this->column(column+k) + row;
+      for(UInt i=0; i<A.rows(); i++)
+        c[i] = a[i*strideRow];
+    }
+  }
+
+  /** @brief Copy the block starting at (@a row, @a column) into @a A (size is given by @a A). */
+  void copyTo(UInt row, UInt column, MatrixSliceRef A) const
+  {
+    if((row+A.rows() > rows_) || (column+A.columns() > columns_))
+      throw(Exception("Dimension error: MatrixSmall("s+rows_%"%i x "s+columns_%"%i), A("s+A.rows()%"%i x "s+A.columns()%"%i) at ("s+row%"%i, "s+column%"%i)"s));
+    const UInt strideRow    = A.isRowMajorOrder() ? A.ld() : 1;
+    const UInt strideColumn = A.isRowMajorOrder() ? 1 : A.ld();
+    for(UInt k=0; k<A.columns(); k++)
+    {
+      const Double *c = this->column(column+k) + row;
+      Double       *a = A.field() + k*strideColumn;
+      for(UInt i=0; i<A.rows(); i++)
+        a[i*strideRow] = c[i];
+    }
+  }
+
+  /** @brief Copy into a new (GENERAL) Matrix. */
+  Matrix matrix() const {Matrix A(rows_, columns_); copyTo(0, 0, A); return A;}
+
+  /** @brief Remove the first @a count rows. */
+  void removeRows(UInt count)
+  {
+    if(count > rows_)
+      throw(Exception("cannot remove "s+count%"%i rows from "s+rows_%"%i"s));
+    for(UInt k=0; k<columns_; k++)
+      std::copy_n(column(k)+count, rows_-count, column(k));
+    rows_ -= count;
+  }
+};
+
+/***** FUNCTIONS *******************************/
+
+/** @brief Matrix multiplication: C += c * A * B. */
+template<UInt R, UInt K, UInt K2, UInt M>
+inline void matMult(Double c, const MatrixSmall<R,K> &A, const MatrixSmall<K2,M> &B, MatrixSmall<R,M> &C)
+{
+  if((A.columns() != B.rows()) || (A.rows() != C.rows()) || (B.columns() != C.columns()))
+    throw(Exception("Dimension error: A("s+A.rows()%"%i x "s+A.columns()%"%i) * B("s+B.rows()%"%i x "s+B.columns()%"%i) -> C("s+C.rows()%"%i x "s+C.columns()%"%i)"s));
+  for(UInt k=0; k<B.columns(); k++)
+  {
+    Double *c_k = C.column(k);
+    for(UInt l=0; l<A.columns(); l++)
+    {
+      const Double f = c*B(l,k);
+      if(f == 0.)
+        continue;
+      const Double *a_l = A.column(l);
+      for(UInt i=0; i<A.rows(); i++)
+        c_k[i] += f*a_l[i];
+    }
+  }
+}
+
+/***********************************************/
+
+/** @brief Cholesky decomposition A = W^T W.
+* The upper triangle of A is replaced by W, the strict lower triangle is set to zero. */
+template<UInt N, UInt N2>
+inline void cholesky(MatrixSmall<N,N2> &A)
+{
+  if(A.rows() != A.columns())
+    throw(Exception("Dimension error"));
+  for(UInt k=0; k<A.columns(); k++)
+  {
+    Double *a_k = A.column(k);
+    for(UInt j=0; j<=k; j++)
+    {
+      const Double *a_j = A.column(j);
+      Double sum = a_k[j];
+      for(UInt i=0; i<j; i++)
+        sum -= a_j[i]*a_k[i];
+      if(j<k)
+        a_k[j] = sum/a_j[j];
+      else if(sum > 0)
+        a_k[k] = std::sqrt(sum);
+      else
+        throw(Exception("cholesky: matrix is not positive definite (column "s+k%"%i)"s));
+    }
+    for(UInt i=k+1; i<A.rows(); i++)
+      A(i,k) = 0.;
+  }
+}
+
+/***********************************************/
+
+/** @brief QR decomposition with Householder reflections (same representation as LAPACK dgeqrf).
+* R is stored in the upper triangle of @a A, the Householder vectors below the diagonal.
+* @return factors tau of the Householder reflections (first min(rows, columns) elements). */
+template<UInt R, UInt N>
+inline std::array<Double,N> QR_decomposition(MatrixSmall<R,N> &A)
+{
+  std::array<Double,N> tau{};
+  const UInt count = std::min(A.rows(), A.columns());
+  for(UInt j=0; j<count; j++)
+  {
+    // Householder vector (as in dlarfg)
+    Double *a_j = A.column(j);
+    Double xnorm2 = 0;
+    for(UInt i=j+1; i<A.rows(); i++)
+      xnorm2 += a_j[i]*a_j[i];
+    if(xnorm2 == 0.)
+      continue;
+    const Double alpha = a_j[j];
+    const Double beta  = -std::copysign(std::sqrt(alpha*alpha+xnorm2), alpha);
+    tau[j] = (beta-alpha)/beta;
+    const Double scale = 1./(alpha-beta);
+    for(UInt i=j+1; i<A.rows(); i++)
+      a_j[i] *= scale;
+    a_j[j] = beta;
+
+    // apply to remaining columns
+    for(UInt k=j+1; k<A.columns(); k++)
+    {
+      Double *a_k = A.column(k);
+      Double w = a_k[j];
+      for(UInt i=j+1; i<A.rows(); i++)
+        w += a_j[i]*a_k[i];
+      w *= tau[j];
+      a_k[j] -= w;
+      for(UInt i=j+1; i<A.rows(); i++)
+        a_k[i] -= w*a_j[i];
+    }
+  }
+  return tau;
+}
+
+/***********************************************/
+
+/** @brief A := Q^T A, with Q given as Householder reflections from @a QR_decomposition. */
+template<UInt R, UInt N, UInt M>
+inline void QTransMult(const MatrixSmall<R,N> &B, const std::array<Double,N> &tau, MatrixSmall<R,M> &A)
+{
+  if(A.rows() != B.rows())
+    throw(Exception("Dimension error: B("s+B.rows()%"%i x "s+B.columns()%"%i), A("s+A.rows()%"%i x "s+A.columns()%"%i)"s));
+  const UInt count = std::min(B.rows(), B.columns());
+  for(UInt j=0; j<count; j++)
+  {
+    if(tau[j] == 0.)
+      continue;
+    const Double *v = B.column(j);
+    for(UInt k=0; k<A.columns(); k++)
+    {
+      Double *a_k = A.column(k);
+      Double w = a_k[j];
+      for(UInt i=j+1; i<A.rows(); i++)
+        w += v[i]*a_k[i];
+      w *= tau[j];
+      a_k[j] -= w;
+      for(UInt i=j+1; i<A.rows(); i++)
+        a_k[i] -= w*v[i];
+    }
+  }
+}
+
+/***********************************************/
+
+/** @brief A := Q A, with Q given as Householder reflections from @a QR_decomposition. */
+template<UInt R, UInt N, UInt M>
+inline void QMult(const MatrixSmall<R,N> &B, const std::array<Double,N> &tau, MatrixSmall<R,M> &A)
+{
+  if(A.rows() != B.rows())
+    throw(Exception("Dimension error: B("s+B.rows()%"%i x "s+B.columns()%"%i), A("s+A.rows()%"%i x "s+A.columns()%"%i)"s));
+  const UInt count = std::min(B.rows(), B.columns());
+  for(UInt j=count; j-->0;)
+  {
+    if(tau[j] == 0.)
+      continue;
+    const Double *v = B.column(j);
+    for(UInt k=0; k<A.columns(); k++)
+    {
+      Double *a_k = A.column(k);
+      Double w = a_k[j];
+      for(UInt i=j+1; i<A.rows(); i++)
+        w += v[i]*a_k[i];
+      w *= tau[j];
+      a_k[j] -= w;
+      for(UInt i=j+1; i<A.rows(); i++)
+        a_k[i] -= w*v[i];
+    }
+  }
+}
+
+/***********************************************/
+
+/** @brief Solve W x = c (in place of the first W.columns() rows of @a C), W is the upper triangle of @a W. */
+template<UInt R, UInt N, UInt M>
+inline void triangularSolve(const MatrixSmall<R,N> &W, MatrixSmall<R,M> &C)
+{
+  const UInt n = W.columns();
+  for(UInt k=0; k<C.columns(); k++)
+  {
+    Double *c_k = C.column(k);
+    for(UInt i=n; i-->0;)
+    {
+      Double sum = c_k[i];
+      for(UInt j=i+1; j<n; j++)
+        sum -= W(i,j)*c_k[j];
+      c_k[i] = sum/W(i,i);
+    }
+  }
+}
+
+/***********************************************/
+
+/** @brief Eliminate parameters @a B from the observation equations @a A.
+* Same as @a eliminationParameter for Matrix: A := (Q^T A) without the first B.columns() rows,
+* where B = QR. @a B is overwritten by its QR decomposition. */
+template<UInt R, UInt N, UInt M>
+inline void eliminationParameter(MatrixSmall<R,N> &B, MatrixSmall<R,M> &A)
+{
+  const std::array<Double,N> tau = QR_decomposition(B);
+  QTransMult(B, tau, A);
+  A.removeRows(B.columns());
+}
+
+/// @}
+
+/***********************************************/
+
+#endif /* __GROOPS_MATRIXSMALL__ */
@@ -149,3 +149,40 @@ Bool ParameterName::operator<(const ParameterName &other) const
 }
 
 /***********************************************/
+
+std::size_t ParameterName::Hash::operator()(const ParameterName &name) const
+{
+  const std::hash<std::string> hash;
+  std::size_t seed = 0;
+  for(const std::string *str : {&name.object, &name.type, &name.temporal, &name.interval})
+    seed ^= hash(*str) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+  return seed;
+}
+
+/***********************************************/
+/***********************************************/
+
+ParameterNameIndex::ParameterNameIndex(const std::vector<ParameterName> &names, Bool unique)
+{
+  try
+  {
+    index.reserve(names.size());
+    for(UInt i=0; i<names.size(); i++)
+      if(!index.emplace(names.at(i), i).second && unique) // keeps first occurrence
+        throw(Exception("parameter name <"+names.at(i).str()+"> is not unique ("+index.at(names.at(i))%"%i"s+". and "+i%"%i. parameter)"s));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+UInt ParameterNameIndex::find(const ParameterName &name) const
+{
+  auto iter = index.find(name);
+  return (iter != index.end()) ? iter->second : NULLINDEX;
+}
+
+/***********************************************/
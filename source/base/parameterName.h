@@ -13,6 +13,7 @@
 #ifndef __GROOPS_PARAMETERNAME__
 #define __GROOPS_PARAMETERNAME__
 
+#include <unordered_map>
 #include "base/importStd.h"
 #include "base/time.h"
 
@@ -70,6 +71,34 @@ public:
 
   /** @brief Sort operator. */
   Bool operator<(const ParameterName &other) const;
+
+  /** @brief Hash function, e.g. for std::unordered_map. */
+  struct Hash
+  {
+    std::size_t operator()(const ParameterName &name) const;
+  };
+};
+
+/***********************************************/
+
+/**
+* @brief Hash index of a list of parameter names.
+* Finds the position of a name in the list in constant time.
+* If a name appears more than once, only the first position is indexed (first match),
+* unless the index is constructed as unique, which rejects duplicates.
+* @ingroup base */
+class ParameterNameIndex
+{
+  std::unordered_map<ParameterName, UInt, ParameterName::Hash> index;
+
+public:
+  /** @brief Constructor. Builds the index of @p names.
+  * @param names list of parameter names
+  * @param unique throw an exception if a name appears more than once (use where a unique mapping is required) */
+  explicit ParameterNameIndex(const std::vector<ParameterName> &names, Bool unique=FALSE);
+
+  /** @brief Returns the (first) position of @p name in the list or NULLINDEX if not found. */
+  UInt find(const ParameterName &name) const;
 };
 
 /***********************************************/
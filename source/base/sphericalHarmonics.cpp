@@ -15,45 +15,17 @@
 #include "base/importStd.h"
 #include "base/tensor3d.h"
 #include "base/rotary3d.h"
+#include "base/legendreFunction.h"
 #include "base/sphericalHarmonics.h"
 
 /***********************************************/
 
-Matrix SphericalHarmonics::factor1;
-Matrix SphericalHarmonics::factor2;
-
-/***********************************************/
-
-void SphericalHarmonics::computeFactors(UInt degree)
-{
-  // Enough factors?
-  if(factor1.rows()>degree)
-    return;
-
-  factor1 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-  factor2 = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
-
-  // factors for the recursion P[n-1][n-1] -> P[n][n]
-  if(degree>0) factor1(1,1) = std::sqrt(3.);
-  for(UInt n=2; n<=degree; n++)
-    factor1(n,n) =  std::sqrt((2.*n+1.)/(2.*n));
-
-  // factors for the recursion P[m][n-1] and P[m][n-2] -> P[m][n]
-  for(UInt m=0; m<degree; m++)
-    for(UInt n=m+1; n<=degree; n++)
-    {
-      Double f = (2.*n+1.)/static_cast<Double>((n+m)*(n-m));
-      factor1(n,m) =  std::sqrt(f*(2.*n-1.));
-      factor2(n,m) = -std::sqrt(f*(n-m-1.)*(n+m-1.)/(2.*n-3.));
-    }
-}
-
-/***********************************************/
-
 // Basis functions Ynm (Cnm and Snm)
 void SphericalHarmonics::CnmSnm(const Vector3d &point, UInt degree, Matrix &Cnm, Matrix &Snm, Bool interior)
 {
-  computeFactors(degree);
+  const auto factors = LegendreFunction::factors(degree);
+  const Matrix &factor1 = factors->factor1;
+  const Matrix &factor2 = factors->factor2;
 
   Cnm = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
   Snm = Matrix(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
@@ -65,7 +37,6 @@ void SphericalHarmonics::CnmSnm(const Vector3d &point, UInt degree, Matrix &Cnm,
     x  = point.x() * rr;
     y  = point.y() * rr;
     z  = point.z() * rr;
-    Cnm(0,0) = 1e280/point.r(); // dirty trick: to account for small numbers in very high degrees.
   }
   else
   {
@@ -73,15 +44,24 @@ void SphericalHarmonics::CnmSnm(const Vector3d &point, UInt degree, Matrix &Cnm,
     x  = point.x();
     y  = point.y();
     z  = point.z();
-    Cnm(0,0) = 1e280; // dirty trick: to account for small numbers in very high degrees.
   }
 
   // Recursion diagonal
   // C(n-1,n-1) -> C(n,n)
+  // with extended exponent range, orders with underflow (near the poles) are computed separately
+  std::vector<Double> sectoral(2*(degree+1)); // C(m,m), S(m,m)
+  std::vector<Int>    exponent(degree+1, 0);
+  sectoral.at(0) = Cnm(0,0) = (interior) ? 1. : 1./point.r();
   for(UInt n=1; n<=degree; n++)
   {
-    Cnm(n,n) = factor1(n,n) * (x * Cnm(n-1,n-1) - y * Snm(n-1,n-1));
-    Snm(n,n) = factor1(n,n) * (y * Cnm(n-1,n-1) + x * Snm(n-1,n-1));
+    const Double *cs1 = &sectoral.at(2*n-2);
+    Double       *cs  = &sectoral.at(2*n);
+    cs[0] = factor1(n,n) * (x * cs1[0] - y * cs1[1]);
+    cs[1] = factor1(n,n) * (y * cs1[0] + x * cs1[1]);
+    exponent.at(n) = exponent.at(n-1);
+    LegendreFunction::normalizeExtended(cs, 2, exponent.at(n));
+    Cnm(n,n) = (exponent.at(n)==0) ? cs[0] : 0.;
+    Snm(n,n) = (exponent.at(n)==0) ? cs[1] : 0.;
   }
 
   // Recursion secondary diagonal
@@ -98,8 +78,9 @@ void SphericalHarmonics::CnmSnm(const Vector3d &point, UInt degree, Matrix &Cnm,
   {
     for(UInt m=0; m<(degree-1); m++)
     {
-      Double *c  = &Cnm(m+2,m),     *s  = &Snm(m+2,m);
-      Double *f1 = &factor1(m+2,m), *f2 = &factor2(m+2,m);
+      Double *c  = &Cnm(m+2,m), *s = &Snm(m+2,m);
+      const Double *f1 = factor1.slice(m+2, m, degree-m-1, 1).field();
+      const Double *f2 = factor2.slice(m+2, m, degree-m-1, 1).field();
 
       for(UInt n=m+2; n<=degree; n++)
       {
@@ -110,37 +91,147 @@ void SphericalHarmonics::CnmSnm(const Vector3d &point, UInt degree, Matrix &Cnm,
     }
   }
 
-  Cnm *= 1e-280; // dirty trick: to account for small numbers in very high degrees.
-  Snm *= 1e-280;
+  // orders with underflow of the sectorals
+  for(UInt m=0; m<=degree; m++)
+    if(exponent.at(m)!=0)
+      LegendreFunction::recursionExtended(*factors, m, degree, z, rr, sectoral.at(2*m), sectoral.at(2*m+1), exponent.at(m),
+                                          [&](UInt n, Double c, Double s) {Cnm(n,m) = c; Snm(n,m) = s;});
 }
 
 /***********************************************/
 
-Matrix SphericalHarmonics::Pnm(Angle theta, Double _r, UInt degree, Bool interior)
+void SphericalHarmonics::CnmSnm(const std::vector<Vector3d> &points, UInt degree, Matrix &Cnm, Matrix &Snm, Bool interior)
 {
-  computeFactors(degree);
+  const auto factors = LegendreFunction::factors(degree);
+  const Matrix &factor1 = factors->factor1;
+  const Matrix &factor2 = factors->factor2;
+
+  const UInt count = points.size();
+  Cnm = Matrix(count, (degree+1)*(degree+2)/2);
+  Snm = Matrix(count, (degree+1)*(degree+2)/2);
+  if(!count)
+    return;
 
-  Matrix Pnm(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+  auto c = [&](UInt n, UInt m) {return Cnm.field() + (n*(n+1)/2+m)*count;};
+  auto s = [&](UInt n, UInt m) {return Snm.field() + (n*(n+1)/2+m)*count;};
 
-  Double r;
-  if(!interior)
+  std::vector<Double> rr(count), x(count), y(count), z(count);
+  for(UInt i=0; i<count; i++)
   {
-    r = 1/_r;
-    Pnm(0,0) = 1e280*r; // dirty trick: to account for small numbers in very high degrees.
+    if(!interior)
+    {
+      rr[i] = pow(1/points[i].r(),2);
+      x[i]  = points[i].x() * rr[i];
+      y[i]  = points[i].y() * rr[i];
+      z[i]  = points[i].z() * rr[i];
+      c(0,0)[i] = 1./points[i].r();
+    }
+    else
+    {
+      rr[i] = pow(points[i].r(),2);
+      x[i]  = points[i].x();
+      y[i]  = points[i].y();
+      z[i]  = points[i].z();
+      c(0,0)[i] = 1.;
+    }
   }
-  else
+
+  // Recursion diagonal
+  // C(n-1,n-1) -> C(n,n)
+  // with extended exponent range, orders with underflow (near the poles) are computed separately
+  struct Extended {UInt i, m; Double cs[2]; Int exponent;};
+  std::vector<Extended> extended;
+  std::vector<Double>   cs(2*count); // C(n,n), S(n,n) of each point
+  std::vector<Int>      exponent(count, 0);
+  for(UInt i=0; i<count; i++)
+    cs[2*i] = c(0,0)[i];
+  for(UInt n=1; n<=degree; n++)
   {
-    r = _r;
-    Pnm(0,0) = 1e280; // dirty trick: to account for small numbers in very high degrees.
+    const Double f = factor1(n,n);
+    Double *cn = c(n,n), *sn = s(n,n);
+    for(UInt i=0; i<count; i++)
+    {
+      const Double c1 = cs[2*i], s1 = cs[2*i+1];
+      cs[2*i]   = f * (x[i] * c1 - y[i] * s1);
+      cs[2*i+1] = f * (y[i] * c1 + x[i] * s1);
+      cn[i] = cs[2*i];
+      sn[i] = cs[2*i+1];
+    }
+    for(UInt i=0; i<count; i++)
+    {
+      LegendreFunction::normalizeExtended(&cs[2*i], 2, exponent[i]);
+      if(exponent[i]!=0)
+      {
+        extended.push_back(Extended{i, n, {cs[2*i], cs[2*i+1]}, exponent[i]});
+        cn[i] = sn[i] = 0.;
+      }
+    }
   }
+
+  // Recursion secondary diagonal
+  // C(n-1,n-1) -> C(n,n-1)
+  for(UInt n=1; n<=degree; n++)
+  {
+    const Double f = factor1(n,n-1);
+    const Double *c1 = c(n-1,n-1), *s1 = s(n-1,n-1);
+    Double *cn = c(n,n-1), *sn = s(n,n-1);
+    for(UInt i=0; i<count; i++)
+    {
+      cn[i] = f * z[i] * c1[i];
+      sn[i] = f * z[i] * s1[i];
+    }
+  }
+
+  // Recursion others
+  // C(n-1,m),C(n-2,m) -> C(n,m)
+  for(UInt m=0; m+1<degree; m++)
+    for(UInt n=m+2; n<=degree; n++)
+    {
+      const Double f1 = factor1(n,m), f2 = factor2(n,m);
+      const Double *c1 = c(n-1,m), *s1 = s(n-1,m);
+      const Double *c2 = c(n-2,m), *s2 = s(n-2,m);
+      Double *cn = c(n,m), *sn = s(n,m);
+      for(UInt i=0; i<count; i++)
+      {
+        cn[i] = f1 * z[i] * c1[i] + f2 * rr[i] * c2[i];
+        sn[i] = f1 * z[i] * s1[i] + f2 * rr[i] * s2[i];
+      }
+    }
+
+  // orders with underflow of the sectorals
+  for(const Extended &e : extended)
+    LegendreFunction::recursionExtended(*factors, e.m, degree, z[e.i], rr[e.i], e.cs[0], e.cs[1], e.exponent,
+                                        [&](UInt n, Double cnm, Double snm) {c(n,e.m)[e.i] = cnm; s(n,e.m)[e.i] = snm;});
+}
+
+/***********************************************/
+
+Matrix SphericalHarmonics::Pnm(Angle theta, Double _r, UInt degree, Bool interior)
+{
+  const auto factors = LegendreFunction::factors(degree);
+  const Matrix &factor1 = factors->factor1;
+  const Matrix &factor2 = factors->factor2;
+
+  Matrix Pnm(degree+1, Matrix::TRIANGULAR, Matrix::LOWER);
+
+  const Double r  = (interior) ? _r : 1/_r;
   const Double rr = pow(r,2);
   const Double x  = sin(theta) * r;
   const Double z  = cos(theta) * r;
 
   // Recursion diagonal
   // C(n-1,n-1) -> C(n,n)
+  // with extended exponent range, orders with underflow (near the poles) are computed separately
+  std::vector<Double> sectoral(degree+1);
+  std::vector<Int>    exponent(degree+1, 0);
+  sectoral.at(0) = Pnm(0,0) = (interior) ? 1. : r;
   for(UInt n=1; n<=degree; n++)
-    Pnm(n,n) = factor1(n,n) * (x * Pnm(n-1,n-1));
+  {
+    sectoral.at(n) = factor1(n,n) * x * sectoral.at(n-1);
+    exponent.at(n) = exponent.at(n-1);
+    LegendreFunction::normalizeExtended(&sectoral.at(n), 1, exponent.at(n));
+    Pnm(n,n) = (exponent.at(n)==0) ? sectoral.at(n) : 0.;
+  }
 
   // Recursion secondary diagonal
   // C(n-1,n-1) -> C(n,n-1)
@@ -154,8 +245,8 @@ Matrix SphericalHarmonics::Pnm(Angle theta, Double _r, UInt degree, Bool interio
     for(UInt m=0; m<(degree-1); m++)
     {
       Double *c  = &Pnm(m+2,m);
-      Double *f1 = &factor1(m+2,m);
-      Double *f2 = &factor2(m+2,m);
+      const Double *f1 = factor1.slice(m+2, m, degree-m-1, 1).field();
+      const Double *f2 = factor2.slice(m+2, m, degree-m-1, 1).field();
 
       for(UInt n=m+2; n<=degree; n++)
       {
@@ -165,7 +256,12 @@ Matrix SphericalHarmonics::Pnm(Angle theta, Double _r, UInt degree, Bool interio
     }
   }
 
-  Pnm *= 1e-280; // dirty trick: to account for small numbers in very high degrees.
+  // orders with underflow of the sectorals
+  for(UInt m=0; m<=degree; m++)
+    if(exponent.at(m)!=0)
+      LegendreFunction::recursionExtended(*factors, m, degree, z, rr, sectoral.at(m), 0., exponent.at(m),
+                                          [&](UInt n, Double c, Double /*s*/) {Pnm(n,m) = c;});
+
   return Pnm;
 }
 
@@ -639,6 +735,148 @@ Tensor3d SphericalHarmonics::gravityGradient(const Vector3d &point, UInt maxDegr
 
 /***********************************************/
 
+std::vector<Tensor3d> SphericalHarmonics::gravityGradient(const std::vector<Vector3d> &points, UInt maxDegree, UInt minDegree) const
+{
+  try
+  {
+    if(_interior)
+      throw(Exception("not implemented yet for inner space"));
+
+    maxDegree = std::min(maxDegree, this->maxDegree());
+
+    std::vector<Tensor3d> tensor(points.size());
+    const UInt blockSize = 32; // epochs computed at once
+    std::vector<Vector3d> pointsBlock;
+    std::vector<Double>   Kxx, Kxy, Kxz, Kyy, Kyz, Kzz;
+    for(UInt k0=0; k0<points.size(); k0+=blockSize)
+    {
+      const UInt count = std::min(blockSize, points.size()-k0);
+      pointsBlock.resize(count);
+      for(UInt i=0; i<count; i++)
+        pointsBlock[i] = 1/R() * points.at(k0+i);
+
+      Matrix Cnm, Snm;
+      CnmSnm(pointsBlock, maxDegree+2, Cnm, Snm);
+      auto c = [&](UInt n, UInt m) {return &Cnm(0, n*(n+1)/2+m);};
+      auto s = [&](UInt n, UInt m) {return &Snm(0, n*(n+1)/2+m);};
+
+      Kxx.assign(count, 0.); Kxy.assign(count, 0.); Kxz.assign(count, 0.);
+      Kyy.assign(count, 0.); Kyz.assign(count, 0.); Kzz.assign(count, 0.);
+
+      // all degrees
+      for(UInt n=minDegree; n<=maxDegree; n++)
+      {
+        const Double factor = std::sqrt((2.*n+1.)/(2.*n+5.));
+
+        // 0. Order
+        {
+          const Double cnm = factor*_cnm(n,0);
+          const Double wm0 = std::sqrt(static_cast<Double>(n+1)*(n+2)*(n+1)*(n+2));
+          const Double wp1 = std::sqrt(static_cast<Double>(n+1)*(n+1)*(n+2)*(n+3)) / std::sqrt(2.0);
+          const Double wp2 = std::sqrt(static_cast<Double>(n+1)*(n+2)*(n+3)*(n+4)) / std::sqrt(2.0);
+
+          const Double *cm0 = c(n+2,0);
+          const Double *cp1 = c(n+2,1), *sp1 = s(n+2,1);
+          const Double *cp2 = c(n+2,2), *sp2 = s(n+2,2);
+          for(UInt i=0; i<count; i++)
+          {
+            const Double Cm0 = wm0*cm0[i];
+            const Double Cp1 = wp1*cp1[i];  const Double Sp1 = wp1*sp1[i];
+            const Double Cp2 = wp2*cp2[i];  const Double Sp2 = wp2*sp2[i];
+
+            Kxx[i] += cnm * (-2*Cm0 + 2*Cp2);
+            Kxy[i] += cnm * ( 2*Sp2);
+            Kxz[i] += cnm * ( 4*Cp1);
+            Kyy[i] += cnm * (-2*Cm0 - 2*Cp2);
+            Kyz[i] += cnm * ( 4*Sp1);
+            Kzz[i] += cnm * ( 4*Cm0);
+          }
+        }
+
+        // 1. order
+        if(n>0)
+        {
+          const UInt m = 1;
+          const Double cnm = factor*_cnm(n,m);
+          const Double snm = factor*_snm(n,m);
+          const Double wm1 = std::sqrt(static_cast<Double>(n-m+1)*(n-m+2)*(n-m+3)*(n+m+1)) * std::sqrt(2.0);
+          const Double wm0 = std::sqrt(static_cast<Double>(n-m+1)*(n-m+2)*(n+m+1)*(n+m+2));
+          const Double wp1 = std::sqrt(static_cast<Double>(n-m+1)*(n+m+1)*(n+m+2)*(n+m+3));
+          const Double wp2 = std::sqrt(static_cast<Double>(n+m+1)*(n+m+2)*(n+m+3)*(n+m+4));
+
+          const Double *cm1 = c(n+2,m-1), *sm1 = s(n+2,m-1);
+          const Double *cm0 = c(n+2,m  ), *sm0 = s(n+2,m  );
+          const Double *cp1 = c(n+2,m+1), *sp1 = s(n+2,m+1);
+          const Double *cp2 = c(n+2,m+2), *sp2 = s(n+2,m+2);
+          for(UInt i=0; i<count; i++)
+          {
+            const Double Cm1 = wm1*cm1[i];  const Double Sm1 = wm1*sm1[i];
+            const Double Cm0 = wm0*cm0[i];  const Double Sm0 = wm0*sm0[i];
+            const Double Cp1 = wp1*cp1[i];  const Double Sp1 = wp1*sp1[i];
+            const Double Cp2 = wp2*cp2[i];  const Double Sp2 = wp2*sp2[i];
+
+            Kxx[i] += cnm * (- 3*Cm0 + Cp2)  + snm * (- Sm0 + Sp2);
+            Kxy[i] += cnm * (-   Sm0 + Sp2)  + snm * (- Cm0 - Cp2);
+            Kxz[i] += cnm * (-2*Cm1 + 2*Cp1) + snm * (-2*Sm1 + 2*Sp1);
+            Kyy[i] += cnm * (-   Cm0 - Cp2)  + snm * (- 3*Sm0 - Sp2);
+            Kyz[i] += cnm * (2*Sp1)          + snm * (-2*Cm1 - 2*Cp1);
+            Kzz[i] += cnm * (4*Cm0)          + snm * (4*Sm0);
+          }
+        } // end 1. order
+
+        // all other orders
+        for(UInt m=2; m<=n; m++)
+        {
+          const Double cnm = factor*_cnm(n,m);
+          const Double snm = factor*_snm(n,m);
+          const Double wm2 = std::sqrt(static_cast<Double>(n-m+1)*(n-m+2)*(n-m+3)*(n-m+4)) * ((m==2) ? std::sqrt(2.0) : 1.0);
+          const Double wm1 = std::sqrt(static_cast<Double>(n-m+1)*(n-m+2)*(n-m+3)*(n+m+1));
+          const Double wm0 = std::sqrt(static_cast<Double>(n-m+1)*(n-m+2)*(n+m+1)*(n+m+2));
+          const Double wp1 = std::sqrt(static_cast<Double>(n-m+1)*(n+m+1)*(n+m+2)*(n+m+3));
+          const Double wp2 = std::sqrt(static_cast<Double>(n+m+1)*(n+m+2)*(n+m+3)*(n+m+4));
+
+          const Double *cm2 = c(n+2,m-2), *sm2 = s(n+2,m-2);
+          const Double *cm1 = c(n+2,m-1), *sm1 = s(n+2,m-1);
+          const Double *cm0 = c(n+2,m  ), *sm0 = s(n+2,m  );
+          const Double *cp1 = c(n+2,m+1), *sp1 = s(n+2,m+1);
+          const Double *cp2 = c(n+2,m+2), *sp2 = s(n+2,m+2);
+          for(UInt i=0; i<count; i++)
+          {
+            const Double Cm2 = wm2*cm2[i];  const Double Sm2 = wm2*sm2[i];
+            const Double Cm1 = wm1*cm1[i];  const Double Sm1 = wm1*sm1[i];
+            const Double Cm0 = wm0*cm0[i];  const Double Sm0 = wm0*sm0[i];
+            const Double Cp1 = wp1*cp1[i];  const Double Sp1 = wp1*sp1[i];
+            const Double Cp2 = wp2*cp2[i];  const Double Sp2 = wp2*sp2[i];
+
+            Kxx[i] += cnm * ( Cm2 - 2*Cm0 + Cp2) + snm * ( Sm2 - 2*Sm0 + Sp2);
+            Kxy[i] += cnm * (-Sm2         + Sp2) + snm * ( Cm2         - Cp2);
+            Kxz[i] += cnm * (-2*Cm1 + 2*Cp1)     + snm * (-2*Sm1 + 2*Sp1);
+            Kyy[i] += cnm * (-Cm2 - 2*Cm0 - Cp2) + snm * (-Sm2 - 2*Sm0 - Sp2);
+            Kyz[i] += cnm * ( 2*Sm1 + 2*Sp1)     + snm * (-2*Cm1 - 2*Cp1);
+            Kzz[i] += cnm * (4*Cm0)              + snm * (4*Sm0);
+          }
+        }  // for(m)
+      } // for(n)
+
+      const Double f = GM()/(4*R()*R()*R());
+      for(UInt i=0; i<count; i++)
+      {
+        Tensor3d &K = tensor.at(k0+i);
+        K.xx() = f*Kxx[i]; K.xy() = f*Kxy[i]; K.xz() = f*Kxz[i];
+        K.yy() = f*Kyy[i]; K.yz() = f*Kyz[i]; K.zz() = f*Kzz[i];
+      }
+    } // for(k0)
+
+    return tensor;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Vector3d SphericalHarmonics::deformation(const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, UInt maxDegree, UInt minDegree) const
 {
   try
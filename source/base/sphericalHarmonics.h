@@ -37,11 +37,6 @@ class SphericalHarmonics
   Matrix _cnm, _snm, _sigma2cnm, _sigma2snm;
   Bool   _interior;
 
-  static Matrix factor1, factor2;
-
-  // factors needed for recursion formular
-  static void computeFactors(UInt degree);
-
 public:
   /// Default Constructor.
   explicit SphericalHarmonics(Bool interior=FALSE);
@@ -61,6 +56,11 @@ public:
   * @f[ S_{nm}(\lambda,\vartheta,r) = r^n \sin(m\lambda)P_n^m(\cos\vartheta) @f] */
   static void CnmSnm(const Vector3d &point, UInt maxDegree, Matrix &Cnm, Matrix &Snm, Bool interior=FALSE);
 
+  /** @brief Solid spherical harmonics (Cnm und Snm) at many points.
+  * Same as the single point version, but the recursion is computed for all @a points at once.
+  * The basis function of degree n and order m at point i is stored in Cnm(i, n*(n+1)/2+m). */
+  static void CnmSnm(const std::vector<Vector3d> &points, UInt maxDegree, Matrix &Cnm, Matrix &Snm, Bool interior=FALSE);
+
   /** @brief Solid Legendre functions (Pnm).
   * (4Pi normalized).
   * @f[ P_{nm}(\lambda,\vartheta,r) = \frac{1}{r^{n+1}} P_n^m(\cos\vartheta) @f]
@@ -107,6 +107,11 @@ public:
   * @f[ T(P) = \nabla \nabla V(P) @f] */
   Tensor3d gravityGradient(const Vector3d &point, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0) const;
 
+  /** @brief Gravitational gradient (Tensor) at many points.
+  * Same as the single point version, but the recursion and the weights of each degree and order
+  * are shared by blocks of points, the inner loops over the points can be vectorized. */
+  std::vector<Tensor3d> gravityGradient(const std::vector<Vector3d> &points, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0) const;
+
   /** @brief Deformation due to loading.
   * @param  point station position [m]
   * @param  gravity local gravity at station [m/s**2]
@@ -162,6 +162,16 @@ Tensor3d Gravityfield::gravityGradient(const Time &time, const Vector3d &point)
 
 /***********************************************/
 
+std::vector<Tensor3d> Gravityfield::gravityGradient(const std::vector<Time> &time, const std::vector<Vector3d> &point) const
+{
+  std::vector<Tensor3d> tensor(point.size());
+  for(UInt i=0; i<gravityfield.size(); i++)
+    gravityfield.at(i)->gravityGradient(time, point, tensor);
+  return tensor;
+}
+
+/***********************************************/
+
 Vector3d Gravityfield::deformation(const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln) const
 {
   Vector3d sum;
@@ -277,6 +287,16 @@ Matrix Gravityfield::variance(const Time &time, const std::vector<Vector3d> &poi
 
 /***********************************************/
 
+Vector Gravityfield::variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel) const
+{
+  Vector d(point.size());
+  for(UInt i=0; i<gravityfield.size(); i++)
+    gravityfield.at(i)->variances(time, point, kernel, d);
+  return d;
+}
+
+/***********************************************/
+
 Double Gravityfield::variance(const Time &time, const Vector3d &point, const Kernel &kernel) const
 {
   Double sigma2 = 0;
@@ -390,6 +410,15 @@ Double GravityfieldBase::field(const Time &time, const Vector3d &point, const Ke
 
 /***********************************************/
 
+// Default implementation
+void GravityfieldBase::gravityGradient(const std::vector<Time> &time, const std::vector<Vector3d> &point, std::vector<Tensor3d> &tensor) const
+{
+  for(UInt i=0; i<point.size(); i++)
+    tensor.at(i) += gravityGradient(time.at(i), point.at(i));
+}
+
+/***********************************************/
+
 // Default implementation
 Matrix GravityfieldBase::sphericalHarmonicsCovariance(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const
 {
@@ -411,6 +440,22 @@ Double GravityfieldBase::variance(const Time &time, const Vector3d &point, const
 
 /***********************************************/
 
+// Default implementation
+void GravityfieldBase::variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    for(UInt i=0; i<point.size(); i++)
+      d(i) += variance(time, point.at(i), kernel);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 // Default implementation
 Double GravityfieldBase::covariance(const Time &time, const Vector3d &point1, const Vector3d &point2, const Kernel &kernel) const
 {
@@ -423,3 +468,111 @@ Double GravityfieldBase::covariance(const Time &time, const Vector3d &point1, co
 }
 
 /***********************************************/
+
+Matrix GravityfieldBase::synthesisMatrix(const SphericalHarmonics &harmonics, const std::vector<Vector3d> &point, const Kernel &kernel)
+{
+  try
+  {
+    const UInt   maxDegree = harmonics.maxDegree();
+    const Double GM = harmonics.GM();
+    const Double R  = harmonics.R();
+    const UInt   count = point.size();
+    const UInt   dim   = (maxDegree+1)*(maxDegree+2)/2;
+
+    std::vector<Vector3d> p(count);
+    Matrix coeff(count, maxDegree+1);
+    for(UInt i=0; i<count; i++)
+    {
+      p.at(i) = 1/R * point.at(i);
+      copy(GM/R * kernel.inverseCoefficients(point.at(i), maxDegree, harmonics.isInterior()).trans(), coeff.row(i));
+    }
+    Matrix Cnm, Snm;
+    SphericalHarmonics::CnmSnm(p, maxDegree, Cnm, Snm, harmonics.isInterior());
+
+    // columns: cnm(n,m) at n*(n+1)/2+m, followed by snm
+    const Matrix sigma2cnm = harmonics.sigma2cnm();
+    const Matrix sigma2snm = harmonics.sigma2snm();
+    Matrix S(count, 2*dim);
+    for(UInt n=0; n<=maxDegree; n++)
+      for(UInt m=0; m<=n; m++)
+      {
+        const UInt   idx    = n*(n+1)/2+m;
+        const Double sigmaC = std::sqrt(sigma2cnm(n,m));
+        const Double sigmaS = std::sqrt(sigma2snm(n,m));
+        for(UInt i=0; i<count; i++)
+        {
+          S(i, idx)     = coeff(i,n) * Cnm(i, idx) * sigmaC;
+          S(i, dim+idx) = coeff(i,n) * Snm(i, idx) * sigmaS;
+        }
+      }
+    return S;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+UInt GravityfieldBase::synthesisBlockSize(UInt maxDegree, UInt matrixCount)
+{
+  constexpr UInt memorySize = 100*1024*1024; // 100 MB
+  const UInt columns = (maxDegree+1)*(maxDegree+2); // cnm and snm
+  return std::max(memorySize/(matrixCount*columns*sizeof(Double)), UInt(1));
+}
+
+/***********************************************/
+
+void GravityfieldBase::variancePropagation(const SphericalHarmonics &harmonics, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D)
+{
+  try
+  {
+    // blocks of points: synthesis matrices are computed again for each block row,
+    // the cost is small compared to the matrix multiplications
+    const UInt blockSize = synthesisBlockSize(harmonics.maxDegree(), 2/*Si, Sk*/);
+    for(UInt i=0; i<point.size(); i+=blockSize)
+    {
+      const UInt countI = std::min(blockSize, point.size()-i);
+      const Matrix Si = synthesisMatrix(harmonics, std::vector<Vector3d>(point.begin()+i, point.begin()+i+countI), kernel);
+      MatrixSlice Dii(D.slice(i, i, countI, countI));
+      Dii.setType(Matrix::SYMMETRIC, Matrix::UPPER);
+      rankKUpdate(1., Si.trans(), Dii);
+      for(UInt k=i+countI; k<point.size(); k+=blockSize)
+      {
+        const UInt countK = std::min(blockSize, point.size()-k);
+        MatrixSlice Dik(D.slice(i, k, countI, countK));
+        Dik.setType(Matrix::GENERAL);
+        matMult(1., Si, synthesisMatrix(harmonics, std::vector<Vector3d>(point.begin()+k, point.begin()+k+countK), kernel).trans(), Dik);
+      }
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void GravityfieldBase::variancesPropagation(const SphericalHarmonics &harmonics, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d)
+{
+  try
+  {
+    const UInt blockSize = synthesisBlockSize(harmonics.maxDegree());
+    for(UInt i=0; i<point.size(); i+=blockSize)
+    {
+      const UInt count = std::min(blockSize, point.size()-i);
+      const Matrix S = synthesisMatrix(harmonics, std::vector<Vector3d>(point.begin()+i, point.begin()+i+count), kernel);
+      for(UInt k=0; k<S.columns(); k++)
+        for(UInt j=0; j<count; j++)
+          d(i+j) += S(j,k)*S(j,k);
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
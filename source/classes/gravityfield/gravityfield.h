@@ -101,6 +101,14 @@ public:
   * @return Result is given in an Earth fixed system [1/s^2]. */
   Tensor3d gravityGradient(const Time &time, const Vector3d &point) const;
 
+  /** @brief Gravity gradients at many epochs.
+  * Same as calling the single epoch version for each pair of @a time and @a point,
+  * but static spherical harmonics are computed for all epochs at once.
+  * @param time If time==Time(), only the static part will be computed.
+  * @param point computation points in an Earth fixed reference system [m].
+  * @return Result is given in an Earth fixed system [1/s^2]. */
+  std::vector<Tensor3d> gravityGradient(const std::vector<Time> &time, const std::vector<Vector3d> &point) const;
+
   /** @brief Deformation due to loading.
   * @param  time point in time
   * @param  point station position in TRF [m]
@@ -134,6 +142,11 @@ public:
   * Variance-Covariance-Matrix of gravity field functionals at a list of grid points. */
   Matrix variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel) const;
 
+  /** @brief Variances of gravity field functionals.
+  * Variances at a list of grid points, this is the diagonal of the Variance-Covariance-Matrix
+  * without computing the covariances. */
+  Vector variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel) const;
+
   /** @brief Variance of gravity field functional.
   * Variance of a gravity field functional at one point. */
   Double variance(const Time &time, const Vector3d &point, const Kernel &kernel) const;
@@ -179,6 +192,7 @@ virtual Double   potential      (const Time &time, const Vector3d &point) const
 virtual Double   radialGradient (const Time &time, const Vector3d &point) const = 0;
 virtual Vector3d gravity        (const Time &time, const Vector3d &point) const = 0;
 virtual Tensor3d gravityGradient(const Time &time, const Vector3d &point) const = 0;
+virtual void     gravityGradient(const std::vector<Time> &time, const std::vector<Vector3d> &point, std::vector<Tensor3d> &tensor) const;
 virtual Vector3d deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln) const = 0;
 virtual void     deformation    (const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
                                  const Vector &hn, const Vector &ln, std::vector< std::vector<Vector3d> > &disp) const = 0;
@@ -186,11 +200,19 @@ virtual void     deformation    (const std::vector<Time> &time, const std::vecto
 static Matrix deformationMatrix(const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
                                 const Vector &hn, const Vector &ln, Double GM, Double R, UInt maxDegree);
 
+// variance propagation of (diagonal) sigmas of spherical harmonics: D += S*S^T (d += diag(S*S^T))
+static Matrix synthesisMatrix(const SphericalHarmonics &harmonics, const std::vector<Vector3d> &point, const Kernel &kernel);
+static void   variancePropagation (const SphericalHarmonics &harmonics, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D);
+static void   variancesPropagation(const SphericalHarmonics &harmonics, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d);
+// number of points per block, so that matrixCount synthesis matrices need about 100 MB (at least one point)
+static UInt   synthesisBlockSize(UInt maxDegree, UInt matrixCount=1);
+
 virtual SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, Double GM=0.0, Double R=0.0) const = 0;
 virtual Matrix   sphericalHarmonicsCovariance(const Time &time, UInt maxDegree=INFINITYDEGREE, UInt minDegree=0, Double GM=0.0, Double R=0.0) const;
 
 virtual void   variance  (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const=0;
 virtual Double variance  (const Time &time, const Vector3d &point, const Kernel &kernel) const;
+virtual void   variances (const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
 virtual Double covariance(const Time &time, const Vector3d &point1, const Vector3d &point2, const Kernel &kernel) const;
 };
 
@@ -184,6 +184,34 @@ void GravityfieldFromParametrization::variance(const Time &time, const std::vect
   }
 }
 
+/***********************************************/
+
+void GravityfieldFromParametrization::variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    Matrix A(point.size(), parametrization->parameterCount());
+    for(UInt i=0; i<point.size(); i++)
+      parametrization->field(time, point.at(i), kernel, A.row(i));
+    if(C.size())
+    {
+      const Matrix AC = A*C;
+      for(UInt i=0; i<point.size(); i++)
+        d(i) += inner(AC.row(i), A.row(i));
+    }
+    else
+    {
+      for(UInt k=0; k<A.columns(); k++)
+        for(UInt i=0; i<point.size(); i++)
+          d(i) += sigma2x(k)*A(i,k)*A(i,k);
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 
 /***********************************************/
 
@@ -64,6 +64,7 @@ public:
                            const Vector &hn, const Vector &ln, std::vector< std::vector<Vector3d> > &disp) const override;
   SphericalHarmonics sphericalHarmonics(const Time &time, UInt maxDegree, UInt minDegree, Double GM, Double R) const override;
   void variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const override;
+  void variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const override;
 };
 
 /***********************************************/
@@ -87,6 +87,15 @@ Tensor3d GravityfieldPotentialCoefficients::gravityGradient(const Time &/*time*/
 
 /***********************************************/
 
+void GravityfieldPotentialCoefficients::gravityGradient(const std::vector<Time> &/*time*/, const std::vector<Vector3d> &point, std::vector<Tensor3d> &tensor) const
+{
+  const std::vector<Tensor3d> tns = harmonics.gravityGradient(point);
+  for(UInt i=0; i<point.size(); i++)
+    tensor.at(i) += tns.at(i);
+}
+
+/***********************************************/
+
 Vector3d GravityfieldPotentialCoefficients::deformation(const Time &/*time*/, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln) const
 {
   return harmonics.deformation(point, gravity, hn, ln);
@@ -113,31 +122,23 @@ void GravityfieldPotentialCoefficients::variance(const Time &/*time*/, const std
   {
     if(!harmonics.sigma2cnm().size())
       return;
+    variancePropagation(harmonics, point, kernel, D);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-    UInt   maxDegree = harmonics.maxDegree();
-    Double GM = harmonics.GM();
-    Double R  = harmonics.R();
+/***********************************************/
 
-    Matrix Cnm_i, Snm_i, Cnm_k, Snm_k;
-    Matrix sigma2cnm = harmonics.sigma2cnm();
-    Matrix sigma2snm = harmonics.sigma2snm();
-
-    for(UInt i=0; i<point.size(); i++)
-    {
-      Vector coeff_i = GM/R * kernel.inverseCoefficients(point.at(i), maxDegree, harmonics.isInterior());
-      SphericalHarmonics::CnmSnm(1/R * point.at(i), maxDegree, Cnm_i, Snm_i, harmonics.isInterior());
-
-      for(UInt k=i; k<point.size(); k++)
-      {
-        Vector coeff_k = GM/R * kernel.inverseCoefficients(point.at(k), maxDegree, harmonics.isInterior());
-        SphericalHarmonics::CnmSnm(1/R * point.at(k), maxDegree, Cnm_k, Snm_k, harmonics.isInterior());
-
-        for(UInt n=0; n<=maxDegree; n++)
-          for(UInt m=0; m<=n; m++)
-            D(i,k) += coeff_i(n) * Cnm_i(n,m) * sigma2cnm(n,m) * Cnm_k(n,m) * coeff_k(n)
-                   +  coeff_i(n) * Snm_i(n,m) * sigma2snm(n,m) * Snm_k(n,m) * coeff_k(n);
-      }
-    }
+void GravityfieldPotentialCoefficients::variances(const Time &/*time*/, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    if(!harmonics.sigma2cnm().size())
+      return;
+    variancesPropagation(harmonics, point, kernel, d);
   }
   catch(std::exception &e)
   {
@@ -56,6 +56,7 @@ public:
   Double   field          (const Time &time, const Vector3d &point, const Kernel &kernel) const;
   Vector3d gravity        (const Time &time, const Vector3d &point) const;
   Tensor3d gravityGradient(const Time &time, const Vector3d &point) const;
+  void     gravityGradient(const std::vector<Time> &time, const std::vector<Vector3d> &point, std::vector<Tensor3d> &tensor) const;
   Vector3d deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln) const;
   void     deformation    (const std::vector<Time> &time, const std::vector<Vector3d> &point, const std::vector<Double> &gravity,
                            const Vector &hn, const Vector &ln, std::vector< std::vector<Vector3d> > &disp) const;
@@ -64,6 +65,7 @@ public:
 
   void   variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
   Double variance(const Time &time, const Vector3d &point, const Kernel &kernel) const;
+  void   variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
 };
 
 /***********************************************/
@@ -114,31 +114,23 @@ void GravityfieldPotentialCoefficientsInterior::variance(const Time &/*time*/, c
   {
     if(!harmonics.sigma2cnm().size())
       return;
+    variancePropagation(harmonics, point, kernel, D);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
 
-    UInt   maxDegree = harmonics.maxDegree();
-    Double GM = harmonics.GM();
-    Double R  = harmonics.R();
+/***********************************************/
 
-    Matrix Cnm_i, Snm_i, Cnm_k, Snm_k;
-    Matrix sigma2cnm = harmonics.sigma2cnm();
-    Matrix sigma2snm = harmonics.sigma2snm();
-
-    for(UInt i=0; i<point.size(); i++)
-    {
-      Vector coeff_i = GM/R * kernel.inverseCoefficients(point.at(i), maxDegree, harmonics.isInterior());
-      SphericalHarmonics::CnmSnm(1/R * point.at(i), maxDegree, Cnm_i, Snm_i, harmonics.isInterior());
-
-      for(UInt k=i; k<point.size(); k++)
-      {
-        Vector coeff_k = GM/R * kernel.inverseCoefficients(point.at(k), maxDegree, harmonics.isInterior());
-        SphericalHarmonics::CnmSnm(1/R * point.at(k), maxDegree, Cnm_k, Snm_k, harmonics.isInterior());
-
-        for(UInt n=0; n<=maxDegree; n++)
-          for(UInt m=0; m<=n; m++)
-            D(i,k) += coeff_i(n) * Cnm_i(n,m) * sigma2cnm(n,m) * Cnm_k(n,m) * coeff_k(n)
-                   +  coeff_i(n) * Snm_i(n,m) * sigma2snm(n,m) * Snm_k(n,m) * coeff_k(n);
-      }
-    }
+void GravityfieldPotentialCoefficientsInterior::variances(const Time &/*time*/, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const
+{
+  try
+  {
+    if(!harmonics.sigma2cnm().size())
+      return;
+    variancesPropagation(harmonics, point, kernel, d);
   }
   catch(std::exception &e)
   {
@@ -59,6 +59,7 @@ public:
 
   void   variance(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Matrix &D) const;
   Double variance(const Time &time, const Vector3d &point, const Kernel &kernel) const;
+  void   variances(const Time &time, const std::vector<Vector3d> &point, const Kernel &kernel, Vector &d) const;
 };
 
 /***********************************************/
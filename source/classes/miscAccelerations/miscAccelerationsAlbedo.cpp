@@ -34,7 +34,9 @@ MiscAccelerationsAlbedo::MiscAccelerationsAlbedo(Config &config)
     readConfig(config, "inputfileEmissivity",   fileNameEmissivity,   Config::OPTIONAL, "{groopsDataDir}/albedo/earth_ceres_emissivity_grid2.5.dat", "");
     readConfig(config, "solarflux",             solarflux,            Config::DEFAULT,   "1367", "solar flux constant in 1 AU [W/m**2]");
     readConfig(config, "factor",                factor,               Config::DEFAULT,   "1.0",  "the result is multplied by this factor, set -1 to substract the field");
+    readConfig(config, "coarseningAngle",       coarseningAngle,      Config::DEFAULT,   "0",    "[degree] blocks of cells seen under a smaller angle are evaluated as one source, 0: all cells");
     if(isCreateSchema(config)) return;
+    coarseningAngle *= DEG2RAD;
 
     // read reflectivity
     if(!fileNameReflectivity.empty())
@@ -61,6 +63,88 @@ MiscAccelerationsAlbedo::MiscAccelerationsAlbedo(Config &config)
     // convert area from unit sphere
     for(UInt i=0; i<points.size(); i++)
       areas.at(i) *= pow(points.at(i).r(), 2);
+
+    // hierarchy of blocks, starting with tiles of 45x45 degree
+    std::vector<std::vector<UInt>> tiles(4*8);
+    for(UInt i=0; i<points.size(); i++)
+    {
+      const UInt row = std::min(static_cast<UInt>(std::floor((points.at(i).phi()+PI/2)/(PI/4))), UInt(3));
+      const UInt col = std::min(static_cast<UInt>(std::floor((points.at(i).lambda()+PI)/(PI/4))), UInt(7));
+      tiles.at(8*row+col).push_back(i);
+    }
+    for(UInt row=0; row<4; row++)
+      for(UInt col=0; col<8; col++)
+        if(tiles.at(8*row+col).size())
+          rootBlocks.push_back(createBlock(tiles.at(8*row+col), -PI+col*PI/4, -PI+(col+1)*PI/4, -PI/2+row*PI/4, -PI/2+(row+1)*PI/4));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+UInt MiscAccelerationsAlbedo::createBlock(const std::vector<UInt> &cells, Double lambda0, Double lambda1, Double phi0, Double phi1)
+{
+  try
+  {
+    Block block;
+
+    // split into 2x2 sub blocks
+    const UInt maxCellCount = 4;
+    if((cells.size() > maxCellCount) && (lambda1-lambda0 > 1e-6))
+    {
+      const Double lambdaMid = 0.5*(lambda0+lambda1);
+      const Double phiMid    = 0.5*(phi0+phi1);
+      std::vector<std::vector<UInt>> subCells(4);
+      for(UInt i : cells)
+        subCells.at(2*(points.at(i).phi() < phiMid ? 0 : 1) + (points.at(i).lambda() < lambdaMid ? 0 : 1)).push_back(i);
+      for(UInt k=0; k<4; k++)
+        if(subCells.at(k).size())
+          block.children.push_back(createBlock(subCells.at(k), (k%2) ? lambdaMid : lambda0, (k%2) ? lambda1 : lambdaMid,
+                                                                (k/2) ? phiMid    : phi0,    (k/2) ? phi1    : phiMid));
+    }
+    else
+      block.cells = cells;
+
+    // properties of all cells in block
+    Double area = 0;
+    block.radiusMin = block.radiusMax = points.at(cells.at(0)).r();
+    block.reflectivity.resize(reflectivity.size(), 0.);
+    block.emissivity.resize(emissivity.size(), 0.);
+    block.centroidReflectivity.resize(reflectivity.size());
+    block.centroidEmissivity.resize(emissivity.size());
+    for(UInt i : cells)
+    {
+      block.center   += areas.at(i) * normalize(points.at(i));
+      block.centroid += areas.at(i) * points.at(i);
+      area           += areas.at(i);
+      block.radiusMin = std::min(block.radiusMin, points.at(i).r());
+      block.radiusMax = std::max(block.radiusMax, points.at(i).r());
+      for(UInt idMonth=0; idMonth<reflectivity.size(); idMonth++)
+      {
+        block.reflectivity.at(idMonth)         += areas.at(i) * reflectivity.at(idMonth).at(i);
+        block.centroidReflectivity.at(idMonth) += areas.at(i) * reflectivity.at(idMonth).at(i) * points.at(i);
+      }
+      for(UInt idMonth=0; idMonth<emissivity.size(); idMonth++)
+      {
+        block.emissivity.at(idMonth)         += areas.at(i) * emissivity.at(idMonth).at(i);
+        block.centroidEmissivity.at(idMonth) += areas.at(i) * emissivity.at(idMonth).at(i) * points.at(i);
+      }
+    }
+    block.centroid *= 1./area;
+    for(UInt idMonth=0; idMonth<reflectivity.size(); idMonth++)
+      block.centroidReflectivity.at(idMonth) = (block.reflectivity.at(idMonth) > 0) ? (1./block.reflectivity.at(idMonth)) * block.centroidReflectivity.at(idMonth) : block.centroid;
+    for(UInt idMonth=0; idMonth<emissivity.size(); idMonth++)
+      block.centroidEmissivity.at(idMonth) = (block.emissivity.at(idMonth) > 0) ? (1./block.emissivity.at(idMonth)) * block.centroidEmissivity.at(idMonth) : block.centroid;
+    block.center = (block.center.r() > 0) ? normalize(block.center) : normalize(points.at(cells.at(0)));
+    block.radius = 0;
+    for(UInt i : cells)
+      block.radius = std::max(block.radius, std::acos(std::min(inner(block.center, normalize(points.at(i))), 1.)));
+
+    blocks.push_back(block);
+    return blocks.size()-1;
   }
   catch(std::exception &e)
   {
@@ -81,8 +165,10 @@ Vector3d MiscAccelerationsAlbedo::acceleration(SatelliteModelPtr satellite, cons
     if(!ephemerides)
       throw(Exception("No ephemerides given"));
 
-    Vector3d posSat = rotSat.inverseRotate(position);
-    Vector3d posSun = rotSat.inverseRotate(ephemerides->position(time, Ephemerides::SUN));
+    // computation in TRF, only the directions are rotated into the satellite frame
+    const Rotary3d rot    = rotEarth * rotSat; // SRF -> TRF
+    const Vector3d posSat = rotEarth.rotate(position);
+    Vector3d posSun = rotEarth.rotate(ephemerides->position(time, Ephemerides::SUN));
 
     const Double AU           = 149597870700.0;
     const Double distanceSun  = posSun.normalize();
@@ -100,35 +186,81 @@ Vector3d MiscAccelerationsAlbedo::acceleration(SatelliteModelPtr satellite, cons
       index2 = std::min(month-1, emissivity.size()-1);
     }
 
-    Vector3d acc;
-    for(UInt i=0; i<points.size(); i++)
+    // sources are collected and evaluated in one batch
+    std::vector<Vector3d> directions;
+    std::vector<Double>   eReflectivities, eEmittances;
+    auto addRadiation = [&](const Vector3d &posEarth, Double reflectivityArea, Double emissivityArea)
     {
-      Vector3d posEarth     = rotSat.inverseRotate(rotEarth.inverseRotate(points.at(i)));
       Vector3d direction    = posSat-posEarth;
       const Double distance = direction.normalize();
-      posEarth.normalize();
+      const Vector3d normal = normalize(posEarth);
 
-      // Cosine of angle of incident radiation
-      const Double cosReflexion = inner(direction, posEarth);
+      // Cosine of angle of reflected radiation
+      const Double cosReflexion = inner(direction, normal);
       if(cosReflexion<=0) // element visible?
-        continue;
-       // Cosine of angle of reflected radiation
-      const Double cosIncident = inner(posSun, posEarth);
+        return;
+      // Cosine of angle of incident radiation
+      const Double cosIncident = inner(posSun, normal);
 
       // Reflected Irradiance
       Double eReflectivity = 0;
-      if(reflectivity.size() && (cosIncident>0))
-        eReflectivity = reflectivity.at(index1).at(i)/(PI*distance*distance)*cosIncident*s0*cosReflexion*areas.at(i);
+      if(cosIncident>0)
+        eReflectivity = reflectivityArea/(PI*distance*distance)*cosIncident*s0*cosReflexion;
 
       // Emitted Irradiance
-      Double eEmittance = 0;
-      if(emissivity.size())
-        eEmittance = emissivity.at(index2).at(i)/(4*PI*distance*distance)*s0*cosReflexion*areas.at(i);
+      const Double eEmittance = emissivityArea/(4*PI*distance*distance)*s0*cosReflexion;
 
-      acc += satellite->accelerationPressure(direction, eReflectivity, eEmittance);
+      if(eReflectivity || eEmittance)
+      {
+        directions.push_back(rot.inverseRotate(direction));
+        eReflectivities.push_back(eReflectivity);
+        eEmittances.push_back(eEmittance);
+      }
+    };
+
+    // traverse the hierarchy of blocks
+    const Double   r      = posSat.r();
+    const Vector3d dirSat = normalize(posSat);
+    std::vector<UInt> stack(rootBlocks.rbegin(), rootBlocks.rend());
+    while(stack.size())
+    {
+      const Block &block = blocks.at(stack.back());
+      stack.pop_back();
+
+      // outside visible cap?
+      if(r <= block.radiusMin)
+        continue;
+      const Double psi = std::acos(std::max(std::min(inner(block.center, dirSat), 1.), -1.));
+      if(psi-block.radius > std::acos(block.radiusMin/r))
+        continue;
+
+      // night side without emissivity?
+      const Double psiSun = std::acos(std::max(std::min(inner(block.center, posSun), 1.), -1.));
+      if(!emissivity.size() && (psiSun-block.radius > PI/2))
+        continue;
+
+      // completely visible, completely lit or dark, and small as seen from the satellite?
+      if((coarseningAngle > 0) && (psi+block.radius < std::acos(block.radiusMax/r)) &&
+         (!reflectivity.size() || (psiSun+block.radius < PI/2) || (psiSun-block.radius > PI/2)) &&
+         (block.radius*block.radiusMax < coarseningAngle*(posSat-block.centroid).r()))
+      {
+        if(reflectivity.size())
+          addRadiation(block.centroidReflectivity.at(index1), block.reflectivity.at(index1), 0.);
+        if(emissivity.size())
+          addRadiation(block.centroidEmissivity.at(index2), 0., block.emissivity.at(index2));
+        continue;
+      }
+
+      stack.insert(stack.end(), block.children.rbegin(), block.children.rend());
+      for(UInt i : block.cells)
+        addRadiation(points.at(i), reflectivity.size() ? reflectivity.at(index1).at(i)*areas.at(i) : 0.,
+                                   emissivity.size()   ? emissivity.at(index2).at(i)*areas.at(i)   : 0.);
     }
 
-    return factor*rotEarth.rotate(rotSat.rotate(acc));
+    Vector3d acc;
+    for(const Vector3d &a : satellite->accelerationPressure(directions, eReflectivities, eEmittances))
+      acc += a;
+    return factor*rot.rotate(acc);
   }
   catch(std::exception &e)
   {
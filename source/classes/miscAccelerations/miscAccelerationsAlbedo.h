@@ -26,6 +26,13 @@ algorithm in:
 Knocke, P. C., Ries, J. C., and Tapley, B. D. (1988). Earth radiation pressure effects on satellites.
 Proceedings of the AIAA/AAS Astrodynamics Conference, 88-4292-CP, 577-87. DOI: 10.2514/6.
 1988-4292.
+
+The grid cells are organized in a hierarchy of blocks. Blocks outside the cap visible from the satellite
+(and blocks on the night side if only the reflectivity is given) are skipped as a whole.
+If \config{coarseningAngle} is set, blocks completely visible and completely lit (or dark),
+which are seen from the satellite under a smaller angle, are evaluated as a single source
+located at their centroid weighted with reflectivity and emissivity respectively.
+With the default of zero all visible cells are evaluated individually.
 )";
 #endif
 
@@ -47,6 +54,28 @@ class MiscAccelerationsAlbedo : public MiscAccelerationsBase
   std::vector<std::vector<Double>> emissivity;
   Double                           solarflux;
   Double                           factor;
+  Double                           coarseningAngle;
+
+  /** @brief Block of grid cells. */
+  class Block
+  {
+  public:
+    Vector3d              center;                ///< unit vector to the center
+    Double                radius;                ///< max. spherical distance of the cells from the center
+    Double                radiusMin, radiusMax;  ///< range of the geocentric distance of the cells
+    Vector3d              centroid;              ///< area weighted centroid of the cells
+    std::vector<Double>   reflectivity;          ///< area weighted sum for each month
+    std::vector<Double>   emissivity;            ///< area weighted sum for each month
+    std::vector<Vector3d> centroidReflectivity;  ///< centroid weighted with area*reflectivity for each month
+    std::vector<Vector3d> centroidEmissivity;    ///< centroid weighted with area*emissivity for each month
+    std::vector<UInt>     children;              ///< index of sub blocks
+    std::vector<UInt>     cells;                 ///< index of cells (only at the lowest level)
+  };
+
+  std::vector<Block> blocks;
+  std::vector<UInt>  rootBlocks;
+
+  UInt createBlock(const std::vector<UInt> &cells, Double lambda0, Double lambda1, Double phi0, Double phi1);
 
 public:
   MiscAccelerationsAlbedo(Config &config);
@@ -221,7 +221,7 @@ void NormalEquation::write(const FileName &fileName)
 
 /***********************************************/
 
-Matrix NormalEquation::solve()
+Matrix NormalEquation::solve(Bool mixedPrecision, Double tolerance, UInt maxIter, Bool timing)
 {
   try
   {
@@ -241,7 +241,19 @@ Matrix NormalEquation::solve()
           }
       }
 
-    x = normals.solve(n, TRUE/*timing*/);
+    if(Parallel::isMaster() && (normals.blockCount() > 1))
+    {
+      Double elements, flops, elementsDense, flopsDense;
+      const UInt blocks      = normals.symbolicCholesky({}, FALSE, elements, flops);
+      const UInt blocksDense = normals.symbolicCholesky({}, TRUE, elementsDense, flopsDense);
+      logInfo<<"  cholesky: "<<blocks<<" of "<<blocksDense<<" blocks, memory "<<elements*sizeof(Double)/1024/1024%"%.1f MB"s
+             <<" (dense "<<elementsDense*sizeof(Double)/1024/1024%"%.1f MB"s<<"), flops "<<flops%"%.2e"s<<" (dense "<<flopsDense%"%.2e)"s<<Log::endl;
+    }
+
+    if(mixedPrecision)
+      x = normals.solveMixedPrecision(n, tolerance, maxIter, timing);
+    else
+      x = normals.solve(n, timing);
     Parallel::broadCast(x);
 
     // N contains now the cholesky decomposition
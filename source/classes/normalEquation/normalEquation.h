@@ -150,9 +150,12 @@ public:
   void write(const FileName &name);
 
   /** @brief Solve the system of normal equations.
+  * With @p mixedPrecision the Cholesky decomposition is computed in single precision
+  * and the solution is improved by iterative refinement until the relative change is below @p tolerance
+  * or @p maxIter iterations are reached (see MatrixDistributed::solveMixedPrecision).
   * Change of state of this class: (NORMAL -> CHOLESKY).
   * @return Solution vector as columns of the matrix. */
-  Matrix solve();
+  Matrix solve(Bool mixedPrecision=FALSE, Double tolerance=1e-12, UInt maxIter=10, Bool timing=TRUE);
 
   /** @brief A posteriori sigma.
   * Change of state of this class: (CHOLESKY -> CHOLESKY). */
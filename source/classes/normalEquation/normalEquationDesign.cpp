@@ -35,6 +35,7 @@ NormalEquationDesign::NormalEquationDesign(Config &config)
     readConfig(config, "aprioriSigma",     sigma2,          Config::DEFAULT,  "1.0", "");
     readConfig(config, "startIndex",       startIndex,      Config::DEFAULT,  "0",   "add this normals at index of total matrix (counting from 0)");
     readConfig(config, "inputfileArcList", fileNameArcList, Config::OPTIONAL, "",    "to accelerate computation");
+    readConfig(config, "keepNormalsInMemory", keepNormals,  Config::DEFAULT,  "0",   "accumulate unweighted normals only once and reuse them in further iterations");
     if(isCreateSchema(config)) return;
 
 
@@ -47,6 +48,7 @@ NormalEquationDesign::NormalEquationDesign(Config &config)
 
     sigma2   *= sigma2;
     sigma2New = sigma2;
+    isCached  = FALSE;
   }
   catch(std::exception &e)
   {
@@ -99,6 +101,8 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
     if(!observation->parameterCount())
       return TRUE;
 
+    if(keepNormals)
+      return addNormalEquationCached(rhsNo, x, Wz, normals, n, lPl, obsCount);
 
     const UInt blockStart = normals.index2block(startIndex);
     const UInt blockEnd   = normals.index2block(startIndex+observation->parameterCount()-1);
@@ -111,14 +115,151 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
 
     // compute observation equations
     // -----------------------------
+    const Double sigma2Solution = sigma2; // weight of the normals x and Wz are solved from
     sigma2   = sigma2New;
     obsCount = 0;
-    Double      ePe        = 0;
-    Double      redundancy = 0;
+    Double      ePe   = 0;
+    Double      WzNWz = 0;
     MatrixSlice x0(x.slice(startIndex, rhsNo, observation->parameterCount(), 1));
     MatrixSlice Wz0(Wz.row(startIndex, observation->parameterCount()));
 
     logStatus<<"accumulate normals from observation equations"<<Log::endl;
+    accumulate(1./sigma2, rhsNo, x0, Wz0, normals, n.row(startIndex, observation->parameterCount()), lPl, obsCount, ePe, WzNWz);
+
+    normals.reduceSum(FALSE);
+    Parallel::reduceSum(n);
+    Parallel::reduceSum(lPl);
+    Parallel::reduceSum(obsCount);
+
+    UInt ready = 0;
+    if(quadsum(x0) > 0)
+    {
+      Parallel::reduceSum(ePe);
+      Parallel::reduceSum(WzNWz);
+      sigma2New = estimateSigma2(ePe, WzNWz, obsCount, sigma2Solution);
+      ready = (std::fabs(sqrt(sigma2New)-std::sqrt(sigma2))/std::sqrt(sigma2New) < 0.01);
+      Parallel::broadCast(sigma2New);
+      Parallel::broadCast(ready);
+    }
+
+    return ready;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool NormalEquationDesign::addNormalEquationCached(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+                                                   MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount)
+{
+  try
+  {
+    const UInt blockStart = normals.index2block(startIndex);
+    const UInt blockEnd   = normals.index2block(startIndex+observation->parameterCount()-1);
+    MatrixSlice x0(x.slice(startIndex, rhsNo, observation->parameterCount(), 1));
+
+    // accumulate unweighted normals only once
+    // ---------------------------------------
+    if(!isCached)
+    {
+      normalsCache.initEmpty(normals.blockIndex(), normals.communicator(), normals.getCalculateRank());
+      for(UInt i=blockStart; i<=blockEnd; i++)
+        for(UInt k=i; k<=blockEnd; k++)
+        {
+          normalsCache.setBlock(i, k);
+          normalsCache.N(i,k) = (i==k) ? Matrix(normalsCache.blockSize(i), Matrix::SYMMETRIC) : Matrix(normalsCache.blockSize(i), normalsCache.blockSize(k));
+        }
+      nCache        = Matrix(observation->parameterCount(), n.columns());
+      lPlCache      = Vector(n.columns());
+      obsCountCache = 0;
+
+      Double ePe = 0, WzNWz = 0; // not used
+      logStatus<<"accumulate normals from observation equations (kept in memory)"<<Log::endl;
+      accumulate(1., rhsNo, x0, Wz.row(startIndex, observation->parameterCount()), normalsCache, nCache, lPlCache, obsCountCache, ePe, WzNWz);
+
+      normalsCache.reduceSum(FALSE);
+      Parallel::reduceSum(nCache);
+      Parallel::reduceSum(lPlCache);
+      Parallel::reduceSum(obsCountCache);
+      isCached = TRUE;
+    }
+
+    // variance factor from stored normals
+    // -----------------------------------
+    UInt ready = 0;
+    const Vector vx = x.column(rhsNo);
+    if(!isStrictlyZero(x0))
+    {
+      Matrix Nvx(vx.rows(), vx.columns());
+      Matrix NWz(Wz.rows(), Wz.columns());
+      for(UInt i=blockStart; i<=blockEnd; i++)
+        for(UInt k=i; k<=blockEnd; k++)
+          if(normalsCache.isMyRank(i, k))
+          {
+            const Matrix &N = normalsCache.N(i,k);
+            matMult(1., N, vx.row(normalsCache.blockIndex(k), normalsCache.blockSize(k)), Nvx.row(normalsCache.blockIndex(i), normalsCache.blockSize(i)));
+            matMult(1., N, Wz.row(normalsCache.blockIndex(k), normalsCache.blockSize(k)), NWz.row(normalsCache.blockIndex(i), normalsCache.blockSize(i)));
+            if(i == k)
+              continue;
+            matMult(1., N.trans(), vx.row(normalsCache.blockIndex(i), normalsCache.blockSize(i)), Nvx.row(normalsCache.blockIndex(k), normalsCache.blockSize(k)));
+            matMult(1., N.trans(), Wz.row(normalsCache.blockIndex(i), normalsCache.blockSize(i)), NWz.row(normalsCache.blockIndex(k), normalsCache.blockSize(k)));
+          }
+      Parallel::reduceSum(Nvx);
+      Parallel::reduceSum(NWz);
+
+      if(Parallel::isMaster())
+      {
+        const Double sigma2Old = sigma2;
+        const Double ePe   = inner(vx, Nvx) - 2*inner(x0, nCache.column(rhsNo)) + lPlCache(rhsNo);
+        const Double WzNWz = inner(Wz, NWz);
+        sigma2 = estimateSigma2(ePe, WzNWz, obsCountCache, sigma2Old);
+        ready  = (std::fabs(std::sqrt(sigma2)-std::sqrt(sigma2Old))/std::sqrt(sigma2) < 0.01);
+      }
+      Parallel::broadCast(sigma2);
+      Parallel::broadCast(ready);
+      sigma2New = sigma2;
+    }
+
+    // add weighted normals
+    // --------------------
+    for(UInt i=blockStart; i<=blockEnd; i++)
+      for(UInt k=i; k<=blockEnd; k++)
+      {
+        normals.setBlock(i, k);
+        if(normalsCache.isMyRank(i, k))
+          axpy(1./sigma2, normalsCache.N(i,k), normals.N(i,k));
+      }
+
+    if(Parallel::isMaster())
+    {
+      axpy(1./sigma2, nCache, n.row(startIndex, nCache.rows()));
+      axpy(1./sigma2, lPlCache, lPl);
+      obsCount += obsCountCache;
+    }
+
+    return ready;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void NormalEquationDesign::accumulate(Double factor, UInt rhsNo, const_MatrixSliceRef x0, const_MatrixSliceRef Wz0,
+                                      MatrixDistributed &normals, MatrixSliceRef n, Vector &lPl, UInt &obsCount, Double &ePe, Double &WzNWz)
+{
+  try
+  {
+    const UInt blockStart = normals.index2block(startIndex);
+    const UInt blockEnd   = normals.index2block(startIndex+observation->parameterCount()-1);
+
+    const MatrixBase::Statistics statistics = MatrixBase::statistics();
+    MatrixBase::PoolScope poolScope; // reuse memory of temporary matrices
     Parallel::forEachInterval(observation->arcCount(), intervals, [&](UInt arcNo)
     {
       // observation equations
@@ -142,12 +283,12 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
 
       // right hand side
       // ---------------
-      matMult(1/sigma2, A.trans(), l, n);
+      matMult(factor, A.trans(), l, n);
       for(UInt i=0; i<l.columns(); i++)
-        lPl(i) += quadsum(l.column(i)) + quadsum(l2.column(i))/sigma2;
-      obsCount   += l.rows() + l2.rows();
-      ePe        += (quadsum(l.column(rhsNo) - A*x0) + quadsum(l2.column(rhsNo)))/sigma2;
-      redundancy += l.rows() - quadsum(A*Wz0)/sigma2;
+        lPl(i) += factor * (quadsum(l.column(i)) + quadsum(l2.column(i)));
+      obsCount += l.rows() + l2.rows();
+      ePe      += quadsum(l.column(rhsNo) - A*x0) + quadsum(l2.column(rhsNo));
+      WzNWz    += quadsum(A*Wz0);
 
       // accumulate normals
       // ------------------
@@ -156,34 +297,19 @@ Bool NormalEquationDesign::addNormalEquation(UInt rhsNo, const const_MatrixSlice
         const UInt idxN1 = (normals.blockIndex(i) < startIndex) ? (startIndex-normals.blockIndex(i)) : 0;
         const UInt idxA1 = (normals.blockIndex(i) < startIndex) ? 0 : (normals.blockIndex(i)-startIndex);
         const UInt cols1 = std::min(normals.blockSize(i)-idxN1, A.columns()-idxA1);
-        rankKUpdate(1/sigma2, A.column(idxA1, cols1), normals.N(i,i).slice(idxN1, idxN1, cols1, cols1));
+        rankKUpdate(factor, A.column(idxA1, cols1), normals.N(i,i).slice(idxN1, idxN1, cols1, cols1));
         for(UInt k=i+1; k<=blockEnd; k++)
         {
           const UInt idxN2 = (normals.blockIndex(k) < startIndex) ? (startIndex-normals.blockIndex(k)) : 0;
           const UInt idxA2 = (normals.blockIndex(k) < startIndex) ? 0 : (normals.blockIndex(k)-startIndex);
-          const UInt cols2 = std::min(normals.blockSize(k)-idxN1, A.columns()-idxA1);
-          matMult(1/sigma2, A.column(idxA1, cols1).trans(), A.column(idxA2, cols2), normals.N(i,k).slice(idxN1, idxN2, cols1, cols2));
+          const UInt cols2 = std::min(normals.blockSize(k)-idxN2, A.columns()-idxA2);
+          matMult(factor, A.column(idxA1, cols1).trans(), A.column(idxA2, cols2), normals.N(i,k).slice(idxN1, idxN2, cols1, cols2));
         }
       }
     });
 
-    normals.reduceSum(FALSE);
-    Parallel::reduceSum(n);
-    Parallel::reduceSum(lPl);
-    Parallel::reduceSum(obsCount);
-
-    UInt ready = 0;
-    if(quadsum(x0) > 0)
-    {
-      Parallel::reduceSum(ePe);
-      Parallel::reduceSum(redundancy);
-      sigma2New = ePe/redundancy;
-      ready = (std::fabs(sqrt(sigma2New)-std::sqrt(sigma2))/std::sqrt(sigma2New) < 0.01);
-      Parallel::broadCast(sigma2New);
-      Parallel::broadCast(ready);
-    }
-
-    return ready;
+    const MatrixBase::Statistics stat = MatrixBase::statistics()-statistics;
+    logInfo<<"  matrix allocations: "<<stat.allocations<<" ("<<stat.bytes/1024./1024.%"%.1f MB"s<<"), reused: "<<stat.allocationsPool<<Log::endl;
   }
   catch(std::exception &e)
   {
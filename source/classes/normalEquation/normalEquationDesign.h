@@ -33,6 +33,13 @@ equations is acculumated according to
  \qquad\text{and}\qquad
 \M n = \sum_{i=1}^m \M A_i^T \M l_i.
 \end{equation}
+
+If \config{keepNormalsInMemory} is set, the unweighted normals of this group
+are accumulated only once and kept in memory. In further iterations
+(e.g. in \program{NormalsSolverVCE}) the observation equations are not recomputed,
+the variance factor is estimated from the stored normals and only the weighted
+normals are added to the total system. This needs additional memory for a copy
+of the normal matrix.
 )";
 #endif
 
@@ -54,6 +61,23 @@ class NormalEquationDesign : public NormalEquationBase
   std::vector<UInt> intervals;
   ObservationPtr    observation;
   Double            sigma2, sigma2New;
+  Bool              keepNormals;
+  Bool              isCached;
+  MatrixDistributed normalsCache;
+  Matrix            nCache;
+  Vector            lPlCache;
+  UInt              obsCountCache;
+
+  /** @brief Accumulates normals weighted with @a factor.
+  * @a ePe (residuals of @a x0) and @a WzNWz (@f$ z^TW^TA^TAWz @f$) are unweighted,
+  * the variance factor is estimated from them by @ref estimateSigma2. */
+  void accumulate(Double factor, UInt rhsNo, const_MatrixSliceRef x0, const_MatrixSliceRef Wz0,
+                  MatrixDistributed &normals, MatrixSliceRef n, Vector &lPl, UInt &obsCount, Double &ePe, Double &WzNWz);
+  /** @brief Variance factor from unweighted quantities.
+  * @a sigma2Solution is the variance factor with which the normals of the current solution were weighted. */
+  static Double estimateSigma2(Double ePe, Double WzNWz, UInt obsCount, Double sigma2Solution) {return ePe/(obsCount - WzNWz/sigma2Solution);}
+  Bool addNormalEquationCached(UInt rhsNo, const const_MatrixSlice &x, const const_MatrixSlice &Wz,
+                               MatrixDistributed &normals, Matrix &n, Vector &lPl, UInt &obsCount);
 
 public:
   NormalEquationDesign(Config &config);
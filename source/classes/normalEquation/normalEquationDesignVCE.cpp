@@ -18,6 +18,7 @@
 #include "config/config.h"
 #include "parallel/parallel.h"
 #include "files/fileArcList.h"
+#include "misc/varianceComponentEstimation.h"
 #include "classes/observation/observation.h"
 #include "classes/normalEquation/normalEquation.h"
 #include "classes/normalEquation/normalEquationDesignVCE.h"
@@ -32,9 +33,10 @@ NormalEquationDesignVCE::NormalEquationDesignVCE(Config &config)
 
     renameDeprecatedConfig(config, "arcList", "inputfileArcList", date2time(2020, 7, 7));
 
-    readConfig(config, "observation",      observation,     Config::MUSTSET,  "",  "");
-    readConfig(config, "startIndex",       startIndex,      Config::DEFAULT,  "0", "add this normals at index of total matrix (counting from 0)");
-    readConfig(config, "inputfileArcList", fileNameArcList, Config::OPTIONAL, "", "to accelerate computation");
+    readConfig(config, "observation",        observation,        Config::MUSTSET,  "",  "");
+    readConfig(config, "startIndex",         startIndex,         Config::DEFAULT,  "0", "add this normals at index of total matrix (counting from 0)");
+    readConfig(config, "inputfileArcList",   fileNameArcList,    Config::OPTIONAL, "",  "to accelerate computation");
+    readConfig(config, "monteCarloAccuracy", monteCarloAccuracy, Config::DEFAULT,  "0", "relative accuracy of the estimated trace per arc, no more random vectors are used (0: all)");
     if(isCreateSchema(config)) return;
 
     intervals = {0, observation->arcCount()};
@@ -113,6 +115,8 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
     Vector x0  = x.slice(startIndex, rhsNo, observation->parameterCount(), 1);
     Matrix Wz0 = Wz.row(startIndex, observation->parameterCount());
 
+    const MatrixBase::Statistics statistics = MatrixBase::statistics();
+    MatrixBase::PoolScope poolScope; // reuse memory of temporary matrices
     Parallel::forEachInterval(sigma2, intervals, [&](UInt arcNo) -> Double
     {
       // observation equations
@@ -137,12 +141,12 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
       // Partial redundancy
       // trace(A'A*N^(-1)) = trace(A'A*W^(-1)*W^(-T))
       //                   = z'*W^(-1)*A'*A*W^(-T)*z (MonteCarlo trace estimation)
-      const Double r      = l.rows() + l2.rows() - quadsum(A*Wz0)/sigma2.at(arcNo);
+      const Double r      = l.rows() + l2.rows() - Vce::traceMonteCarlo(A, Wz0, monteCarloAccuracy)/sigma2.at(arcNo);
       const Double sigma2 = (quadsum(l.column(rhsNo)-A*x0) + quadsum(l2.column(rhsNo)))/r;
 
       // right hand side
       // ---------------
-      matMult(1./sigma2, A.trans(),l, n);
+      matMult(1./sigma2, A.trans(), l, n.row(startIndex, A.columns()));
       for(UInt i=0; i<l.columns(); i++)
         lPl(i) += (quadsum(l.column(i))+quadsum(l2.column(i)))/sigma2;
       obsCount += l.rows() + l2.rows();
@@ -159,13 +163,15 @@ Bool NormalEquationDesignVCE::addNormalEquation(UInt rhsNo, const const_MatrixSl
         {
           const UInt idxN2 = (normals.blockIndex(k) < startIndex) ? (startIndex-normals.blockIndex(k)) : 0;
           const UInt idxA2 = (normals.blockIndex(k) < startIndex) ? 0 : (normals.blockIndex(k)-startIndex);
-          const UInt cols2 = std::min(normals.blockSize(k)-idxN1, A.columns()-idxA1);
+          const UInt cols2 = std::min(normals.blockSize(k)-idxN2, A.columns()-idxA2);
           matMult(1/sigma2, A.column(idxA1, cols1).trans(), A.column(idxA2, cols2), normals.N(i,k).slice(idxN1, idxN2, cols1, cols2));
         }
       }
 
       return sigma2;
     });
+    const MatrixBase::Statistics stat = MatrixBase::statistics()-statistics;
+    logInfo<<"  matrix allocations: "<<stat.allocations<<" ("<<stat.bytes/1024./1024.%"%.1f MB"s<<"), reused: "<<stat.allocationsPool<<Log::endl;
 
     normals.reduceSum(FALSE);
     Parallel::reduceSum(n);
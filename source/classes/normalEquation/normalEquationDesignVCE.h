@@ -42,6 +42,9 @@ The variance $\sigma_i^2$ of each individual arc is determined by
 \end{equation}
 where $n_i$ is the number of observations. If an apriori solution is not given at the first
 iteration step a zero vector is assumed.
+
+The trace is estimated by Monte Carlo random vectors. With \config{monteCarloAccuracy} only so many
+random vectors are used per arc until the standard deviation of the estimated trace is below this relative accuracy.
 )";
 #endif
 
@@ -62,6 +65,7 @@ class NormalEquationDesignVCE : public NormalEquationBase
 {
   UInt                 iter;
   UInt                 startIndex;
+  Double               monteCarloAccuracy;
   std::vector<Double>  sigma2;
   ObservationPtr       observation;
   std::vector<UInt>    intervals;
@@ -115,9 +115,14 @@ void ObservationGradiometer::observation(UInt arcNo, Matrix &l, Matrix &A, Matri
 
     // earth rotation
     // --------------
+    const std::vector<Time> times = orbit.times();
     std::vector<Rotary3d> rotEarth(epochCount);
+    std::vector<Vector3d> posEarth(epochCount);
     for(UInt i=0; i<epochCount; i++)
-      rotEarth.at(i) = earthRotation->rotaryMatrix(orbit.at(i).time);
+    {
+      rotEarth.at(i) = earthRotation->rotaryMatrix(times.at(i));
+      posEarth.at(i) = rotEarth.at(i).rotate(orbit.at(i).position);
+    }
 
     // reduced observations
     // ---------------------
@@ -135,13 +140,14 @@ void ObservationGradiometer::observation(UInt arcNo, Matrix &l, Matrix &A, Matri
         Arc::checkSynchronized({orbit, reference.at(k)});
       }
 
+      // referencefield for all epochs at once
+      const std::vector<Tensor3d> gradient = rhs.at(rhsNo)->referencefield->gravityGradient(times, posEarth);
+
       for(UInt i=0; i<epochCount; i++)
       {
-        const Time     time     = orbit.at(i).time;
-        const Vector3d posEarth = rotEarth.at(i).rotate(orbit.at(i).position);
         // referencefield + tides
-        const Tensor3d tns = rhs.at(rhsNo)->referencefield->gravityGradient(time, posEarth)
-                           + rhs.at(rhsNo)->tides->gradient(time, posEarth, rotEarth.at(i), earthRotation, ephemerides);
+        const Tensor3d tns = gradient.at(i)
+                           + rhs.at(rhsNo)->tides->gradient(times.at(i), posEarth.at(i), rotEarth.at(i), earthRotation, ephemerides);
         // observed minus computed
         Tensor3d gravityGradient = gradiometer.at(i).gravityGradient - starCamera.at(i).rotary.inverseRotate(rotEarth.at(i).inverseRotate(tns));
         // gradients from files
@@ -188,7 +194,6 @@ void ObservationGradiometer::observation(UInt arcNo, Matrix &l, Matrix &A, Matri
     // gradiometer bias for each component
     // -----------------------------------
     B = Matrix();
-    const std::vector<Time> times = orbit.times();
     sggBias->setInterval(times.front(), times.back()+medianSampling(times), TRUE);
     if(sggBias->parameterCount())
     {
@@ -67,15 +67,11 @@ inline std::vector<UInt> ParameterSelectorNames::indexVector(const std::vector<P
 {
   try
   {
+    const ParameterNameIndex index(parameterNames);
     std::vector<UInt> vector;
-    auto iter = parameterNames.begin(); // assume ordered list to accelerate search
+    vector.reserve(requestedNames.size());
     for(const auto &name : requestedNames)
-    {
-      iter = std::find(iter, parameterNames.end(), name);
-      if(iter == parameterNames.end()) // not found? -> restart search from begin
-        iter = std::find(parameterNames.begin(), parameterNames.end(), name);
-      vector.push_back((iter != parameterNames.end()) ? std::distance(parameterNames.begin(), iter) : NULLINDEX);
-    }
+      vector.push_back(index.find(name));
 
     return vector;
   }
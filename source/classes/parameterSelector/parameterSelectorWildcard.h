@@ -18,6 +18,7 @@
 static const char *docstringParameterSelectorWildcard = R"(
 \subsection{Wildcard}\label{parameterSelectorType:wildcard}
 Parameter index vector from name. Name matching supports wildcards * for any number of characters and ? for exactly one character.
+Each part of the name (object, type, temporal, interval) is matched separately.
 Does not add zero/empty parameters if there are no matches.
 )";
 #endif
@@ -68,12 +69,34 @@ inline std::vector<UInt> ParameterSelectorWildcard::indexVector(const std::vecto
 {
   try
   {
-    const std::regex pattern = String::wildcard2regex(ParameterName(object, type, temporal, interval).str());
+    // match each part separately and remember the result of each distinct string,
+    // as most parts (objects, types, intervals) are repeated many times
+    class Matcher
+    {
+      const Bool matchAll;
+      std::regex pattern;
+      std::unordered_map<std::string, Bool> known;
+    public:
+      explicit Matcher(const std::string &wildcard) : matchAll(wildcard == "*") {if(!matchAll) pattern = String::wildcard2regex(wildcard);}
+      Bool match(const std::string &str)
+      {
+        if(matchAll)
+          return TRUE;
+        auto iter = known.find(str);
+        if(iter == known.end())
+          iter = known.emplace(str, std::regex_match(str, pattern)).first;
+        return iter->second;
+      }
+    };
 
+    Matcher matchObject(object), matchType(type), matchTemporal(temporal), matchInterval(interval);
     std::vector<UInt> vector;
     for(UInt i=0; i<parameterWildcards.size(); i++)
-      if(std::regex_match(parameterWildcards.at(i).str(), pattern))
+    {
+      const ParameterName &name = parameterWildcards.at(i);
+      if(matchObject.match(name.object) && matchType.match(name.type) && matchTemporal.match(name.temporal) && matchInterval.match(name.interval))
         vector.push_back(i);
+    }
 
     return vector;
   }
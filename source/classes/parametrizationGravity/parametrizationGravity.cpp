@@ -151,6 +151,14 @@ void ParametrizationGravity::gravity(const Time &time, const Vector3d &point, Ma
 
 /***********************************************/
 
+void ParametrizationGravity::gravity(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  for(UInt i=0; i<parametrizations.size(); i++)
+    parametrizations.at(i)->gravity(times, points, A.slice(0,index.at(i),3*points.size(),parametrizations.at(i)->parameterCount()));
+}
+
+/***********************************************/
+
 void ParametrizationGravity::gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const
 {
   for(UInt i=0; i<parametrizations.size(); i++)
@@ -200,3 +208,18 @@ SphericalHarmonics ParametrizationGravity::sphericalHarmonics(const Time &time,
 }
 
 /***********************************************/
+
+void ParametrizationGravityBase::gravity(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  try
+  {
+    for(UInt k=0; k<points.size(); k++)
+      gravity(times.at(k), points.at(k), A.row(3*k, 3));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -112,6 +112,15 @@ public:
   * @param A Must be a (sub)matrix with the dimension (3 x parameterCount()). It is filled with the partial derivatives with respect to the parameters. */
   void gravity(const Time &time, const Vector3d &point, MatrixSliceRef A) const;
 
+  /** @brief Gravity vector at many epochs.
+  * Observation equations for the gravity (x,y,z) in TRF at @a points [m/s^2] for a whole arc.
+  * The result is the same as calling the single epoch version for each epoch,
+  * but parametrizations can compute all epochs at once (e.g. spherical harmonics).
+  * @param times Time of observations.
+  * @param points Computational points in TRF [m].
+  * @param A Must be a (sub)matrix with the dimension (3*points.size() x parameterCount()). Rows 3*k..3*k+2 are filled with the partial derivatives at epoch k. */
+  void gravity(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
+
   /** @brief Gravity Gradient.
   * Six observations equations for gravity gradients (xx,xy,xz,yy,yz,zz) in TRF at @a point [1/s].
   * @param time Time of observation.
@@ -172,6 +181,7 @@ public:
   virtual void potential      (const Time &time, const Vector3d &point, MatrixSliceRef A) const = 0;
   virtual void radialGradient (const Time &time, const Vector3d &point, MatrixSliceRef A) const = 0;
   virtual void gravity        (const Time &time, const Vector3d &point, MatrixSliceRef A) const = 0;
+  virtual void gravity        (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const;
   virtual void gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const = 0;
   virtual void deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const = 0;
 
@@ -201,6 +201,96 @@ void ParametrizationGravitySphericalHarmonics::gravity(const Time &/*time*/, con
 
 /***********************************************/
 
+void ParametrizationGravitySphericalHarmonics::gravity(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  try
+  {
+    // rows of one column must be contiguous in memory
+    if(A.isRowMajorOrder())
+      return ParametrizationGravityBase::gravity(times, points, A);
+
+    const UInt blockSize = 32; // epochs computed at once
+    std::vector<Vector3d> pointsBlock;
+    for(UInt k0=0; k0<points.size(); k0+=blockSize)
+    {
+      const UInt count = std::min(blockSize, points.size()-k0);
+      pointsBlock.resize(count);
+      for(UInt i=0; i<count; i++)
+        pointsBlock[i] = 1/R * points.at(k0+i);
+
+      Matrix Cnm, Snm;
+      SphericalHarmonics::CnmSnm(pointsBlock, maxDegree+1, Cnm, Snm);
+      auto c = [&](UInt n, UInt m) {return &Cnm(0, n*(n+1)/2+m);};
+      auto s = [&](UInt n, UInt m) {return &Snm(0, n*(n+1)/2+m);};
+
+      // 0. Order
+      for(UInt n=minDegree; n<=maxDegree; n++)
+      {
+        if(idxC[n][0]==NULLINDEX)
+          continue;
+
+        Double factor = sqrt((2.*n+1.)/(2.*n+3.))*GM/(2.*R*R);
+
+        Double wm0 = sqrt((n+1.)*(n+1.));
+        Double wp1 = sqrt((n+1.)*(n+2.)) / sqrt(2.0);
+
+        const Double *c0 = c(n+1,0);
+        const Double *c1 = c(n+1,1), *s1 = s(n+1,1);
+        Double *a = &A(3*k0, idxC[n][0]);
+        for(UInt i=0; i<count; i++)
+        {
+          a[3*i+0] = factor*(-2*(wp1*c1[i]));
+          a[3*i+1] = factor*(-2*(wp1*s1[i]));
+          a[3*i+2] = factor*(-2*(wm0*c0[i]));
+        }
+      }
+
+      // all other orders
+      for(UInt m=1; m<=maxDegree; m++)
+        for(UInt n=std::max(minDegree,m); n<=maxDegree; n++)
+        {
+          Double factor = sqrt((2.*n+1.)/(2.*n+3.))*GM/(2.*R*R);
+
+          Double wm1 = sqrt((n-m+1.)*(n-m+2.)) * ((m==1) ? sqrt(2.0) : 1.0);
+          Double wm0 = sqrt((n-m+1.)*(n+m+1.));
+          Double wp1 = sqrt((n+m+1.)*(n+m+2.));
+
+          const Double *cm1 = c(n+1,m-1), *sm1 = s(n+1,m-1);
+          const Double *cm0 = c(n+1,m  ), *sm0 = s(n+1,m  );
+          const Double *cp1 = c(n+1,m+1), *sp1 = s(n+1,m+1);
+
+          if(idxC[n][m]!=NULLINDEX)
+          {
+            Double *a = &A(3*k0, idxC[n][m]);
+            for(UInt i=0; i<count; i++)
+            {
+              a[3*i+0] = factor*( wm1*cm1[i] - wp1*cp1[i]);
+              a[3*i+1] = factor*(-wm1*sm1[i] - wp1*sp1[i]);
+              a[3*i+2] = factor*(-2*(wm0*cm0[i]));
+            }
+          }
+
+          if(idxS[n][m]!=NULLINDEX)
+          {
+            Double *a = &A(3*k0, idxS[n][m]);
+            for(UInt i=0; i<count; i++)
+            {
+              a[3*i+0] = factor*(wm1*sm1[i] - wp1*sp1[i]);
+              a[3*i+1] = factor*(wm1*cm1[i] + wp1*cp1[i]);
+              a[3*i+2] = factor*(-2*(wm0*sm0[i]));
+            }
+          }
+        }
+    } // for(k0)
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void ParametrizationGravitySphericalHarmonics::gravityGradient(const Time &/*time*/, const Vector3d &point, MatrixSliceRef A) const
 {
   try
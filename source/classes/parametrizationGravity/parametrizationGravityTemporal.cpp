@@ -134,6 +134,23 @@ void ParametrizationGravityTemporal::gravity(const Time &time, const Vector3d &p
 
 /***********************************************/
 
+void ParametrizationGravityTemporal::gravity(const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const
+{
+  try
+  {
+    Matrix B(3*points.size(), spatial->parameterCount());
+    spatial->gravity(times, points, B);
+    for(UInt k=0; k<points.size(); k++)
+      temporal->designMatrix(times.at(k), B.row(3*k, 3), A.row(3*k, 3));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void ParametrizationGravityTemporal::gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const
 {
   try
@@ -56,6 +56,7 @@ public:
   void potential      (const Time &time, const Vector3d &point, MatrixSliceRef A) const override;
   void radialGradient (const Time &time, const Vector3d &point, MatrixSliceRef A) const override;
   void gravity        (const Time &time, const Vector3d &point, MatrixSliceRef A) const override;
+  void gravity        (const std::vector<Time> &times, const std::vector<Vector3d> &points, MatrixSliceRef A) const override;
   void gravityGradient(const Time &time, const Vector3d &point, MatrixSliceRef A) const override;
   void deformation    (const Time &time, const Vector3d &point, Double gravity, const Vector &hn, const Vector &ln, MatrixSliceRef A) const override;
   SphericalHarmonics sphericalHarmonics(const Time &time, const Vector &x, UInt maxDegree) const override;
@@ -17,13 +17,15 @@
 #include "external/hwm/hwm.h"
 #include "config/configRegister.h"
 #include "classes/thermosphere/thermosphereJB2008.h"
+#include "classes/thermosphere/thermosphereTabulated.h"
 #include "classes/thermosphere/thermosphere.h"
 
 
 /***********************************************/
 
 GROOPS_REGISTER_CLASS(Thermosphere, "thermosphereType",
-                      ThermosphereJB2008)
+                      ThermosphereJB2008,
+                      ThermosphereTabulated)
 
 GROOPS_READCONFIG_CLASS(Thermosphere, "thermosphereType")
 
@@ -39,6 +41,8 @@ ThermospherePtr Thermosphere::create(Config &config, const std::string &name)
     readConfigChoice(config, name, choice, Config::MUSTSET, "", "density, temperature and velocity");
     if(readConfigChoiceElement(config, "jb2008",  choice, "Jacchia-Bowman 2008 Empirical Thermospheric Density Model"))
       thermosphere = ThermospherePtr(new ThermosphereJB2008(config));
+    if(readConfigChoiceElement(config, "tabulated", choice, "interpolation in tables of another thermosphere model"))
+      thermosphere = ThermospherePtr(new ThermosphereTabulated(config));
     endChoice(config);
 
     return thermosphere;
@@ -51,6 +55,27 @@ ThermospherePtr Thermosphere::create(Config &config, const std::string &name)
 
 /***********************************************/
 
+void Thermosphere::state(const std::vector<Time> &time, const std::vector<Vector3d> &position,
+                         std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const
+{
+  try
+  {
+    if(time.size() != position.size())
+      throw(Exception("size of time ("s+time.size()%"%i) and position ("s+position.size()%"%i) differ"s));
+    density.resize(position.size());
+    temperature.resize(position.size());
+    velocity.resize(position.size());
+    for(UInt i=0; i<position.size(); i++)
+      state(time.at(i), position.at(i), density.at(i), temperature.at(i), velocity.at(i));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Vector Thermosphere::getIndices(const MiscValuesArc &arc, const Time &time, Bool interpolate)
 {
   try
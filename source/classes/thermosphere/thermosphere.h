@@ -61,6 +61,16 @@ public:
   * @param[out] velocity wind in TRF [m/s] */
   virtual void state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const = 0;
 
+  /** @brief Thermospheric state for many points at once.
+  * The default implementation calls @a state for each point.
+  * @param time GPS time of each point
+  * @param position in TRF [m]
+  * @param[out] density  [kg/m^3]
+  * @param[out] temperature  [K]
+  * @param[out] velocity wind in TRF [m/s] */
+  virtual void state(const std::vector<Time> &time, const std::vector<Vector3d> &position,
+                     std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const;
+
   /** @brief creates an derived instance of this class. */
   static ThermospherePtr create(Config &config, const std::string &name);
 
@@ -0,0 +1,298 @@
+/***********************************************/
+/**
+* @file thermosphereTabulated.h
+*
+* @brief Density, temperature and velocity interpolated from tables.
+* @see Thermosphere
+*
+* @date 2026-10-17
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_THERMOSPHERETABULATED__
+#define __GROOPS_THERMOSPHERETABULATED__
+
+// Latex documentation
+#ifdef DOCSTRING_Thermosphere
+static const char *docstringThermosphereTabulated = R"(
+\subsection{Tabulated}
+The thermospheric state of another \configClass{thermosphere}{thermosphereType} model
+is tabulated and interpolated. The tables are given for epochs every \config{timeSampling}
+(aligned with midnight if it is a divisor of a day) and contain ellipsoidal height, latitude, and local solar time
+(angle between the meridian of the point and the Sun) as coordinates.
+The tables are computed on demand and kept in memory for the last epochs used.
+
+The density is interpolated linearly in logarithmic scale, temperature and the horizontal wind
+(in local north and east) linearly. Points outside the height range are computed with the exact model.
+
+The accuracy is controlled by the sampling of the tables. Each table needs
+$n_{height}\cdot n_{latitude}\cdot n_{localTime}$ evaluations of the exact model,
+so the height range should be restricted to the orbits of interest.
+The tables pay off when the model is evaluated many times for the same period,
+e.g. for many satellites, iterations of orbit integration, or dense grids.
+)";
+#endif
+
+/***********************************************/
+
+#include "base/ellipsoid.h"
+#include "base/planets.h"
+#include "classes/thermosphere/thermosphere.h"
+#include <map>
+#include <mutex>
+
+/***** CLASS ***********************************/
+
+/** @brief Density, temperature and velocity interpolated from tables.
+* @ingroup thermosphereGroup
+* @see Thermosphere */
+class ThermosphereTabulated : public Thermosphere
+{
+  /** @brief Table at one epoch (height x latitude x local time). */
+  class Table
+  {
+  public:
+    Double              longitudeSun; ///< Earth fixed longitude of the Sun
+    std::vector<Double> logDensity, temperature, windNorth, windEast;
+  };
+
+  ThermospherePtr thermosphere;
+  Ellipsoid       ellipsoid;
+  Double          minHeight, heightSampling;
+  Double          latitudeSampling, localTimeSampling;
+  Double          timeSampling; // seconds
+  UInt            heightCount, latitudeCount, localTimeCount;
+  UInt            maxTableCount;
+
+  mutable std::mutex                                   mutex;
+  mutable std::map<Int, std::shared_ptr<const Table>>  tables;
+
+  /** @brief Index of the table epoch before @a time and the normalized time since this epoch. */
+  void   tableIndex(const Time &time, Int &idx, Double &tau) const {const Double t = time.mjd()*86400./timeSampling; idx = static_cast<Int>(std::floor(t)); tau = t-idx;}
+  Time   tableTime(Int idx) const {return mjd2time(idx*timeSampling/86400.);}
+  std::shared_ptr<const Table> table(Int idx) const;
+  Bool   interpolate(const Vector3d &position, const Table &table0, const Table &table1, Double tau,
+                     Double &density, Double &temperature, Vector3d &velocity) const;
+
+public:
+  inline ThermosphereTabulated(Config &config);
+
+  inline void state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const override;
+  inline void state(const std::vector<Time> &time, const std::vector<Vector3d> &position,
+                    std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const override;
+};
+
+/***********************************************/
+
+inline ThermosphereTabulated::ThermosphereTabulated(Config &config)
+{
+  try
+  {
+    Double maxHeight;
+    Angle  latitudeSampling_;
+    Double localTimeSampling_, timeSampling_;
+
+    readConfig(config, "thermosphere",      thermosphere,       Config::MUSTSET,  "",       "exact model");
+    readConfig(config, "minHeight",         minHeight,          Config::DEFAULT,  "200e3",  "[m] ellipsoidal height, below the exact model is used");
+    readConfig(config, "maxHeight",         maxHeight,          Config::DEFAULT,  "1000e3", "[m] ellipsoidal height, above the exact model is used");
+    readConfig(config, "heightSampling",    heightSampling,     Config::DEFAULT,  "20e3",   "[m]");
+    readConfig(config, "latitudeSampling",  latitudeSampling_,  Config::DEFAULT,  "10",     "[degree]");
+    readConfig(config, "localTimeSampling", localTimeSampling_, Config::DEFAULT,  "2",      "[hour] of local solar time");
+    readConfig(config, "timeSampling",      timeSampling_,      Config::DEFAULT,  "3",      "[hour] sampling of the tables in time");
+    readConfig(config, "maxTableCount",     maxTableCount,      Config::DEFAULT,  "24",     "tables kept in memory");
+    if(isCreateSchema(config)) return;
+
+    if((heightSampling <= 0) || (maxHeight <= minHeight) || (latitudeSampling_ <= 0) || (localTimeSampling_ <= 0) || (timeSampling_ <= 0))
+      throw(Exception("sampling must be positive and maxHeight > minHeight"));
+
+    heightCount       = static_cast<UInt>(std::ceil((maxHeight-minHeight)/heightSampling-1e-9))+1;
+    latitudeCount     = static_cast<UInt>(std::ceil(PI/latitudeSampling_-1e-9))+1;
+    latitudeSampling  = PI/(latitudeCount-1);
+    localTimeCount    = static_cast<UInt>(std::ceil(24./localTimeSampling_-1e-9));
+    localTimeSampling = 2*PI/localTimeCount;
+    timeSampling      = 3600*timeSampling_;
+    maxTableCount     = std::max(maxTableCount, UInt(2));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline std::shared_ptr<const ThermosphereTabulated::Table> ThermosphereTabulated::table(Int idx) const
+{
+  try
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto iter = tables.find(idx);
+    if(iter != tables.end())
+      return iter->second;
+
+    auto tab = std::make_shared<Table>();
+    const Time time   = tableTime(idx);
+    tab->longitudeSun = Planets::positionSun(time).lambda() - Planets::gmst(timeGPS2UTC(time));
+
+    // all nodes of the table
+    std::vector<Vector3d> points;
+    points.reserve(heightCount*latitudeCount*localTimeCount);
+    for(UInt k=0; k<localTimeCount; k++)
+      for(UInt j=0; j<latitudeCount; j++)
+        for(UInt i=0; i<heightCount; i++)
+          points.push_back(ellipsoid(Angle(tab->longitudeSun+k*localTimeSampling), Angle(j*latitudeSampling-PI/2), minHeight+i*heightSampling));
+
+    std::vector<Double>   density, temperature;
+    std::vector<Vector3d> wind;
+    thermosphere->state(std::vector<Time>(points.size(), time), points, density, temperature, wind);
+
+    tab->logDensity.resize(points.size());
+    tab->temperature = temperature;
+    tab->windNorth.resize(points.size());
+    tab->windEast.resize(points.size());
+    for(UInt i=0; i<points.size(); i++)
+    {
+      tab->logDensity.at(i) = std::log(std::max(density.at(i), 1e-300));
+      const Vector3d windLocal = localNorthEastUp(points.at(i), ellipsoid).inverseTransform(wind.at(i));
+      tab->windNorth.at(i) = windLocal.x();
+      tab->windEast.at(i)  = windLocal.y();
+    }
+
+    // remove the table farthest away in time
+    if(tables.size() >= maxTableCount)
+      tables.erase((std::abs(tables.begin()->first-idx) > std::abs(tables.rbegin()->first-idx)) ? tables.begin() : std::prev(tables.end()));
+    tables[idx] = tab;
+    return tab;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline Bool ThermosphereTabulated::interpolate(const Vector3d &position, const Table &table0, const Table &table1, Double tau,
+                                               Double &density, Double &temperature, Vector3d &velocity) const
+{
+  Angle  lon, lat;
+  Double height;
+  ellipsoid(position, lon, lat, height);
+
+  const Double x = (height-minHeight)/heightSampling;
+  if((x < 0) || (x > heightCount-1))
+    return FALSE;
+  // local solar time: the Earth fixed longitude of the Sun moves nearly uniformly by 2pi per day
+  const Double drift        = -2*PI*timeSampling/86400.;
+  const Double longitudeSun = table0.longitudeSun + tau*(drift+std::remainder(table1.longitudeSun-table0.longitudeSun-drift, 2*PI));
+  const Double localTime    = std::fmod(std::fmod(lon-longitudeSun, 2*PI)+2*PI, 2*PI);
+
+  const Double y = (lat+PI/2)/latitudeSampling;
+  const Double z = localTime/localTimeSampling;
+
+  const UInt   i  = std::min(static_cast<UInt>(x), heightCount-2);
+  const UInt   j  = std::min(static_cast<UInt>(std::max(y, 0.)), latitudeCount-2);
+  const UInt   k0 = std::min(static_cast<UInt>(z), localTimeCount-1);
+  const UInt   k1 = (k0+1) % localTimeCount;
+  const Double wx = x-i;
+  const Double wy = std::min(std::max(y-j, 0.), 1.);
+  const Double wz = std::min(std::max(z-k0, 0.), 1.);
+
+  // trilinear interpolation in both tables, linear in time
+  Double logDensity = 0, temp = 0, north = 0, east = 0;
+  for(UInt c=0; c<8; c++)
+  {
+    const UInt   idx = (i+(c&1)) + heightCount*((j+((c>>1)&1)) + latitudeCount*((c&4) ? k1 : k0));
+    const Double w   = ((c&1) ? wx : 1-wx) * ((c&2) ? wy : 1-wy) * ((c&4) ? wz : 1-wz);
+    logDensity += w * ((1-tau)*table0.logDensity.at(idx)  + tau*table1.logDensity.at(idx));
+    temp       += w * ((1-tau)*table0.temperature.at(idx) + tau*table1.temperature.at(idx));
+    north      += w * ((1-tau)*table0.windNorth.at(idx)   + tau*table1.windNorth.at(idx));
+    east       += w * ((1-tau)*table0.windEast.at(idx)    + tau*table1.windEast.at(idx));
+  }
+
+  density     = std::exp(logDensity);
+  temperature = temp;
+  velocity    = ((north != 0) || (east != 0)) ? localNorthEastUp(position, ellipsoid).transform(Vector3d(north, east, 0)) : Vector3d();
+  return TRUE;
+}
+
+/***********************************************/
+
+inline void ThermosphereTabulated::state(const Time &time, const Vector3d &position, Double &density, Double &temperature, Vector3d &velocity) const
+{
+  try
+  {
+    Int    idx;
+    Double tau;
+    tableIndex(time, idx, tau);
+    if(!interpolate(position, *table(idx), *table(idx+1), tau, density, temperature, velocity))
+      thermosphere->state(time, position, density, temperature, velocity);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+inline void ThermosphereTabulated::state(const std::vector<Time> &time, const std::vector<Vector3d> &position,
+                                         std::vector<Double> &density, std::vector<Double> &temperature, std::vector<Vector3d> &velocity) const
+{
+  try
+  {
+    if(time.size() != position.size())
+      throw(Exception("size of time ("s+time.size()%"%i) and position ("s+position.size()%"%i) differ"s));
+    density.resize(position.size());
+    temperature.resize(position.size());
+    velocity.resize(position.size());
+
+    // points outside the tables are computed at once with the exact model
+    std::vector<UInt>     index;
+    std::vector<Time>     timeExact;
+    std::vector<Vector3d> posExact;
+
+    Int idxTable = 0;
+    std::shared_ptr<const Table> table0, table1;
+    for(UInt i=0; i<position.size(); i++)
+    {
+      Int    idx;
+      Double tau;
+      tableIndex(time.at(i), idx, tau);
+      if(!table0 || (idx != idxTable))
+      {
+        table0   = (table1 && (idx == idxTable+1)) ? table1 : table(idx);
+        table1   = table(idx+1);
+        idxTable = idx;
+      }
+      if(!interpolate(position.at(i), *table0, *table1, tau, density.at(i), temperature.at(i), velocity.at(i)))
+      {
+        index.push_back(i);
+        timeExact.push_back(time.at(i));
+        posExact.push_back(position.at(i));
+      }
+    }
+
+    if(index.size())
+    {
+      std::vector<Double>   densityExact, temperatureExact;
+      std::vector<Vector3d> velocityExact;
+      thermosphere->state(timeExact, posExact, densityExact, temperatureExact, velocityExact);
+      for(UInt i=0; i<index.size(); i++)
+      {
+        density.at(index.at(i))     = densityExact.at(i);
+        temperature.at(index.at(i)) = temperatureExact.at(i);
+        velocity.at(index.at(i))    = velocityExact.at(i);
+      }
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+#endif
@@ -212,4 +212,72 @@ c
       end
 c
 c *******************************************
+c
+      subroutine wrapsgemm(transA,transB,m,n,k,alpha,
+     $                     A,ldA,B,ldB,beta,C,ldC)
+      external sgemm
+      logical*1 transA, transB
+      character trA, trB
+      if(.not.transA) then
+        trA = 'N'
+      else
+        trA = 'T'
+      endif
+      if(.not.transB) then
+        trB = 'N'
+      else
+        trB = 'T'
+      endif
+      call sgemm(trA,trB,m,n,k,alpha,A,ldA,B,ldB,beta,C,ldC)
+      end
+c
+c *******************************************
+c
+      subroutine wrapstrsm(left,upper,trans,diag,m,n,alpha,A,ldA,B,ldB)
+      external strsm
+      logical*1 left, upper, trans, diag
+      character side, uplo,  tr,    diago
+      if(.not.left) then
+        side = 'R'
+      else
+        side = 'L'
+      endif
+      if(.not.upper) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      if(.not.trans) then
+        tr = 'N'
+      else
+        tr = 'T'
+      endif
+      if(.not.diag) then
+        diago = 'N'
+      else
+        diago = 'U'
+      endif
+      call strsm(side,uplo,tr,diago,m,n,alpha,A,ldA,B,ldB)
+      end
+c
+c *******************************************
+c
+      subroutine wrapssyrk(upper,trans,n,k,alpha,A,ldA,beta,C,ldC)
+      external ssyrk
+      logical*1 upper, trans
+      character uplo, tr
+      if(.not.upper) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      if(.not.trans) then
+        tr = 'N'
+      else
+        tr = 'T'
+      endif
+      call ssyrk(uplo,tr,n,k,alpha,A,ldA,beta,C,ldC)
+      end
+c
+c *******************************************
 c
@@ -19,10 +19,15 @@
 
 #define wrapdlacpy  FORTRANCALL(wrapdlacpy, WRAPDLACPY)
 #define wrapdpotrf  FORTRANCALL(wrapdpotrf, WRAPDPOTRF)
+#define wrapspotrf  FORTRANCALL(wrapspotrf, WRAPSPOTRF)
 #define wrapdpotri  FORTRANCALL(wrapdpotri, WRAPDPOTRI)
 #define wrapdpstrf  FORTRANCALL(wrapdpstrf, WRAPDPSTRF)
 #define wrapdtrtri  FORTRANCALL(wrapdtrtri, WRAPDTRTRI)
 #define wrapdlauum  FORTRANCALL(wrapdlauum, WRAPDLAUUM)
+#define wrapdpftrf  FORTRANCALL(wrapdpftrf, WRAPDPFTRF)
+#define wrapdpftri  FORTRANCALL(wrapdpftri, WRAPDPFTRI)
+#define wrapdpftrs  FORTRANCALL(wrapdpftrs, WRAPDPFTRS)
+#define wrapdtftri  FORTRANCALL(wrapdtftri, WRAPDTFTRI)
 #define wrapdgetrf  FORTRANCALL(wrapdgetrf, WRAPDGETRF)
 #define wrapdgesv   FORTRANCALL(wrapdgesv , WRAPDGESV )
 #define wrapdsgesv  FORTRANCALL(wrapdsgesv, WRAPDSGESV)
@@ -48,10 +53,17 @@ void lapack_dlacpy(UInt m, UInt n, const Double A[], UInt ldA, Double B[], UInt
 
 // Cholesky, Inverse
 Int lapack_dpotrf(Bool upper, UInt n, Double A[], UInt ldA);
+Int lapack_spotrf(Bool upper, UInt n, Float  A[], UInt ldA); // single precision
 Int lapack_dpotri(Bool upper, UInt n, Double A[], UInt ldA);
 Int lapack_dtrtri(Bool upper, UInt n, Double A[], UInt ldA);
 Int lapack_dlaumm(Bool upper, UInt n, Double A[], UInt ldA);
 
+// Cholesky, Inverse in rectangular full packed format (RFP)
+Int lapack_dpftrf(Bool upper, UInt n, Double A[]);
+Int lapack_dpftri(Bool upper, UInt n, Double A[]);
+Int lapack_dpftrs(Bool upper, UInt n, UInt nrhs, const Double A[], Double B[], UInt ldB);
+Int lapack_dtftri(Bool upper, UInt n, Double A[]);
+
 // LU-decomposition, Solve, Inverse
 Int lapack_dgetrf(UInt m, UInt n, Double A[], UInt ldA, F77Int ipiv[]);
 Int lapack_dgesv (UInt n, UInt nrhs, Double A[], UInt ldA, F77Int ipiv[], Double B[], UInt ldB);
@@ -89,10 +101,15 @@ extern "C"
 {
 void wrapdlacpy(const F77Int &m, const F77Int &n, const F77Double A[], const F77Int &ldA, F77Double B[], const F77Int &ldB);
 void wrapdpotrf(const F77Int &upper, const F77Int &n, F77Double A[], const F77Int &ldA, F77Int &info);
+void wrapspotrf(const F77Int &upper, const F77Int &n, F77Float  A[], const F77Int &ldA, F77Int &info);
 void wrapdpotri(const F77Int &upper, const F77Int &n, F77Double A[], const F77Int &ldA, F77Int &info);
 void wrapdpstrf(const F77Int &upper, const F77Int &n, F77Double A[], const F77Int &ldA, F77Int ipiv[], F77Int &rank, F77Double &tol, F77Double work[], F77Int &info);
 void wrapdtrtri(const F77Int &upper, const F77Int &n, F77Double A[], const F77Int &ldA, F77Int &info);
 void wrapdlauum(const F77Int &upper, const F77Int &n, F77Double A[], const F77Int &ldA, F77Int &info);
+void wrapdpftrf(const F77Int &upper, const F77Int &n, F77Double A[], F77Int &info);
+void wrapdpftri(const F77Int &upper, const F77Int &n, F77Double A[], F77Int &info);
+void wrapdpftrs(const F77Int &upper, const F77Int &n, const F77Int &nrhs, const F77Double A[], F77Double B[], const F77Int &ldB, F77Int &info);
+void wrapdtftri(const F77Int &upper, const F77Int &n, F77Double A[], F77Int &info);
 void wrapdgetrf(const F77Int &m, const F77Int &n,    F77Double A[], const F77Int &ldA, F77Int ipiv[], F77Int &info);
 void wrapdgesv (const F77Int &n, const F77Int &nrhs, F77Double A[], const F77Int &ldA, F77Int ipiv[], F77Double B[], const F77Int &ldB, F77Int &info);
 void wrapdsgesv(const F77Int &n, const F77Int &nrhs, F77Double A[], const F77Int &ldA, F77Int ipiv[], F77Double B[], const F77Int &ldB, F77Double X[], const F77Int &ldX, F77Double work[], F77Float swork[], F77Int &iter, F77Int &info);
@@ -126,6 +143,13 @@ inline Int lapack_dpotrf(Bool upper, UInt n, Double A[], UInt ldA)
   return info;
 }
 
+inline Int lapack_spotrf(Bool upper, UInt n, Float A[], UInt ldA)
+{
+  F77Int info;
+  wrapspotrf(upper, static_cast<F77Int>(n), A, static_cast<F77Int>(ldA), info);
+  return info;
+}
+
 inline Int lapack_dpotri(Bool upper, UInt n, Double A[], UInt ldA)
 {
   F77Int info;
@@ -156,6 +180,34 @@ inline Int lapack_dlauum(Bool upper, UInt n, Double A[], UInt ldA)
   return info;
 }
 
+inline Int lapack_dpftrf(Bool upper, UInt n, Double A[])
+{
+  F77Int info;
+  wrapdpftrf(upper, static_cast<F77Int>(n), A, info);
+  return info;
+}
+
+inline Int lapack_dpftri(Bool upper, UInt n, Double A[])
+{
+  F77Int info;
+  wrapdpftri(upper, static_cast<F77Int>(n), A, info);
+  return info;
+}
+
+inline Int lapack_dpftrs(Bool upper, UInt n, UInt nrhs, const Double A[], Double B[], UInt ldB)
+{
+  F77Int info;
+  wrapdpftrs(upper, static_cast<F77Int>(n), static_cast<F77Int>(nrhs), A, B, static_cast<F77Int>(ldB), info);
+  return info;
+}
+
+inline Int lapack_dtftri(Bool upper, UInt n, Double A[])
+{
+  F77Int info;
+  wrapdtftri(upper, static_cast<F77Int>(n), A, info);
+  return info;
+}
+
 inline Int lapack_dgetrf(UInt m, UInt n, Double A[], UInt ldA, F77Int ipiv[])
 {
   F77Int info;
@@ -21,6 +21,20 @@ c
       end
 c
 c *******************************************
+c
+      subroutine wrapspotrf(upper,n,A,ldA,info)
+      integer   upper
+      character uplo
+      external spotrf
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      call spotrf(uplo,n,A,ldA,info)
+      end
+c
+c *******************************************
 c
       subroutine wrapdpstrf(upper,n,A,ldA,piv,rank,
      $                      tol,work,info)
@@ -78,6 +92,62 @@ c
       end
 c
 c *******************************************
+c
+      subroutine wrapdpftrf(upper,n,A,info)
+      integer   upper
+      character uplo
+      external dpftrf
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      call dpftrf('N',uplo,n,A,info)
+      end
+c
+c *******************************************
+c
+      subroutine wrapdpftri(upper,n,A,info)
+      integer   upper
+      character uplo
+      external dpftri
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      call dpftri('N',uplo,n,A,info)
+      end
+c
+c *******************************************
+c
+      subroutine wrapdpftrs(upper,n,nrhs,A,B,ldB,info)
+      integer   upper
+      character uplo
+      external dpftrs
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      call dpftrs('N',uplo,n,nrhs,A,B,ldB,info)
+      end
+c
+c *******************************************
+c
+      subroutine wrapdtftri(upper,n,A,info)
+      integer   upper
+      character uplo
+      external dtftri
+      if(upper.eq.0) then
+        uplo = 'L'
+      else
+        uplo = 'U'
+      endif
+      call dtftri('N',uplo,'N',n,A,info)
+      end
+c
+c *******************************************
 c
       subroutine wrapdgetrf(m,n,A,ldA,ipiv,info)
       external dgetrf
@@ -12,6 +12,8 @@
 
 #define DOCSTRING_FILEFORMAT_Instrument
 
+#include <cstring>
+#include <map>
 #include "base/import.h"
 #include "inputOutput/fileArchive.h"
 #include "inputOutput/logging.h"
@@ -552,18 +554,28 @@ void Arc::printStatistics(const Arc &arc)
 /***********************************************/
 
 void Arc::printStatistics(const std::vector<Arc> &arcList)
+{
+  std::vector<std::vector<Time>> timesList;
+  for(const Arc &arc : arcList)
+    timesList.push_back(arc.times());
+  printStatistics(timesList);
+}
+
+/***********************************************/
+
+void Arc::printStatistics(const std::vector<std::vector<Time>> &timesList)
 {
   try
   {
     // number of epochs
     // ----------------
     UInt epochCount = 0;
-    for(UInt arcNo=0; arcNo<arcList.size(); arcNo++)
-      epochCount += arcList.at(arcNo).size();
+    for(UInt arcNo=0; arcNo<timesList.size(); arcNo++)
+      epochCount += timesList.at(arcNo).size();
 
     if(epochCount == 0)
     {
-      logInfo<<"  arc count: "<<arcList.size()<<Log::endl;
+      logInfo<<"  arc count: "<<timesList.size()<<Log::endl;
       logInfo<<"  epochs:    "<<epochCount<<Log::endl;
       return;
     }
@@ -573,14 +585,14 @@ void Arc::printStatistics(const std::vector<Arc> &arcList)
     Bool notSorted = FALSE;
     UInt duplicateCount = 0;
     Time timeStart = date2time(9999,1,1), timeEnd, timeLast = date2time(-9999,1,1);
-    for(UInt arcNo=0; arcNo<arcList.size(); arcNo++)
-      for(UInt i=0; i<arcList.at(arcNo).size(); i++)
+    for(UInt arcNo=0; arcNo<timesList.size(); arcNo++)
+      for(UInt i=0; i<timesList.at(arcNo).size(); i++)
       {
-        if(arcList.at(arcNo).at(i).time == timeLast)
+        if(timesList.at(arcNo).at(i) == timeLast)
           duplicateCount++;
-        if(arcList.at(arcNo).at(i).time < timeLast)
+        if(timesList.at(arcNo).at(i) < timeLast)
           notSorted = TRUE;
-        timeLast  = arcList.at(arcNo).at(i).time;
+        timeLast  = timesList.at(arcNo).at(i);
         timeStart = std::min(timeStart, timeLast);
         timeEnd   = std::max(timeEnd,   timeLast);
       }
@@ -599,21 +611,18 @@ void Arc::printStatistics(const std::vector<Arc> &arcList)
     // median sampling
     // ---------------
     std::vector<Time> times;
-    for(const Arc &arc : arcList)
-    {
-      auto arcTimes = arc.times();
+    for(const auto &arcTimes : timesList)
       times.insert(times.end(), arcTimes.begin(), arcTimes.end());
-    }
     const Double sampling = medianSampling(times).seconds();
     logInfo<<"  median sampling: "<<sampling<<" seconds"<<Log::endl;
 
     // arc statistics
     // --------------
-    if(arcList.size() == 1)
+    if(timesList.size() == 1)
     {
       UInt countGaps = 0;
-      for(UInt i=1; i<arcList.at(0).size(); i++)
-        if((arcList.at(0).at(i).time-arcList.at(0).at(i-1).time).seconds() > 1.5*sampling)
+      for(UInt i=1; i<timesList.at(0).size(); i++)
+        if((timesList.at(0).at(i)-timesList.at(0).at(i-1)).seconds() > 1.5*sampling)
           countGaps++;
       logInfo<<"  gaps:            "<<countGaps<<Log::endl;
     }
@@ -626,12 +635,12 @@ void Arc::printStatistics(const std::vector<Arc> &arcList)
       Time    minTime = seconds2time(100*365*86400.);
       Time    meanTime;
 
-      for(UInt arcNo=0; arcNo<arcList.size(); arcNo++)
+      for(UInt arcNo=0; arcNo<timesList.size(); arcNo++)
       {
-        UInt size = arcList.at(arcNo).size();
+        UInt size = timesList.at(arcNo).size();
         if(size==0)
           continue;
-        Time time = arcList.at(arcNo).at(size-1).time - arcList.at(arcNo).at(0).time;
+        Time time = timesList.at(arcNo).at(size-1) - timesList.at(arcNo).at(0);
 
         maxLen   = std::max(maxLen, size);
         minLen   = std::min(minLen, size);
@@ -644,16 +653,16 @@ void Arc::printStatistics(const std::vector<Arc> &arcList)
 
       UInt minCount = 0;
       UInt maxCount = 0;
-      for(UInt arcNo=0; arcNo<arcList.size(); arcNo++)
+      for(UInt arcNo=0; arcNo<timesList.size(); arcNo++)
       {
-        if(maxLen == arcList.at(arcNo).size()) maxCount++;
-        if(minLen == arcList.at(arcNo).size()) minCount++;
+        if(maxLen == timesList.at(arcNo).size()) maxCount++;
+        if(minLen == timesList.at(arcNo).size()) minCount++;
       }
 
-      meanLen  *= 1./arcList.size();
-      meanTime *= 1./arcList.size();
+      meanLen  *= 1./timesList.size();
+      meanTime *= 1./timesList.size();
 
-      logInfo<<"  arc count:       "<<arcList.size()<<Log::endl;
+      logInfo<<"  arc count:       "<<timesList.size()<<Log::endl;
       logInfo<<"  max. arc length: "<<maxTime.str() <<" with "<<maxLen <<" epochs\t ("<<maxCount<<" arcs)"<<Log::endl;
       logInfo<<"  min. arc length: "<<minTime.str() <<" with "<<minLen <<" epochs\t ("<<minCount<<" arcs)"<<Log::endl;
       logInfo<<"  mean arc length: "<<meanTime.str()<<" with "<<meanLen<<" epochs"<<Log::endl;
@@ -712,10 +721,26 @@ void Arc::save(OutArchive &oa) const
 /***********************************************/
 
 void InstrumentFile::open(const FileName &name)
+{
+  waitPrefetch();
+  openFile(name);
+}
+
+/***********************************************/
+
+void InstrumentFile::close()
+{
+  waitPrefetch();
+  closeFile();
+}
+
+/***********************************************/
+
+void InstrumentFile::openFile(const FileName &name)
 {
   try
   {
-    close();
+    closeFile();
     if(!name.empty())
     {
       file.open(name, ""/*arbitrary type*/);
@@ -759,6 +784,12 @@ void InstrumentFile::open(const FileName &name)
           type = static_cast<Epoch::Type>(typeInt);
         }
         file>>nameValue("arcCount", arcCount_);
+        isGnssCompact = (type == Epoch::GNSSRECEIVER) && (file.archiveType() == InArchive::BINARY) && (file.version() >= 20261017);
+        if(isGnssCompact)
+        {
+          file>>nameValue("types",      gnssTypes);
+          file>>nameValue("satellites", gnssSatellites);
+        }
       }
       else if(file.type().empty() || (file.type() == FILE_MATRIX_TYPE))
       {
@@ -781,13 +812,17 @@ void InstrumentFile::open(const FileName &name)
 
 /***********************************************/
 
-void InstrumentFile::close()
+void InstrumentFile::closeFile()
 {
   if(!fileName.empty())
     file.close();
   fileName  = FileName();
   arcCount_ = 0;
   type      = Epoch::EMPTY;
+  isGnssCompact = FALSE;
+  gnssTypes.clear();
+  gnssSatellites.clear();
+  lastArcMemory = 0;
 }
 
 /***********************************************/
@@ -799,12 +834,84 @@ Arc InstrumentFile::readArc(UInt i)
     if(fileName.empty())
       return Arc();
 
+    Arc arc(type);
+    if(takePrefetchedArc(i, arc))
+      return arc;
+
+    // special case: convert matrix to instrument arc
+    if(file.type().empty() || (file.type() == FILE_MATRIX_TYPE))
+    {
+      if(i>=arcCount_)
+        throw(Exception("index >= arcCount"));
+      if(i<index)
+        openFile(FileName(fileName));
+      Matrix B;
+      std::swap(A, B);
+      index++;
+      return Arc(B, type);
+    }
+
+    readArcEpochs(i, [&](const Epoch &epoch) {arc.push_back(epoch);});
+    return arc;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::readArc(UInt i, const std::function<void(const Epoch &epoch)> &callback)
+{
+  try
+  {
+    if(fileName.empty())
+      return;
+
+    Arc arc;
+    if(takePrefetchedArc(i, arc))
+    {
+      for(UInt k=0; k<arc.size(); k++)
+        callback(arc.at(k));
+      return;
+    }
+
+    readArcEpochs(i, callback);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::readArcEpochs(UInt i, const std::function<void(const Epoch &epoch)> &callback)
+{
+  try
+  {
     if(i>=arcCount_)
       throw(Exception("index >= arcCount"));
 
     // behind arc in file -> restart at beginning
     if(i<index)
-      open(FileName(fileName));
+      openFile(FileName(fileName));
+
+    // estimated memory of the arc (used for prefetching)
+    lastArcMemory = 0;
+    const UInt dataCount = Epoch::dataCount(type);
+    auto callbackMemory = [&](const Epoch &epoch)
+    {
+      if(epoch.getType() == Epoch::GNSSRECEIVER)
+      {
+        const GnssReceiverEpoch &e = static_cast<const GnssReceiverEpoch&>(epoch);
+        lastArcMemory += sizeof(GnssReceiverEpoch) + sizeof(GnssType)*(e.obsType.size()+e.satellite.size()) + sizeof(Double)*e.observation.size();
+      }
+      else
+        lastArcMemory += sizeof(Time) + sizeof(Double)*((dataCount == NULLINDEX) ? 1 : dataCount) + 4*sizeof(void*); // vtable, unique_ptr
+      callback(epoch);
+    };
 
     // special case: convert matrix to instrument arc
     if(file.type().empty() || (file.type() == FILE_MATRIX_TYPE))
@@ -812,26 +919,110 @@ Arc InstrumentFile::readArc(UInt i)
       Matrix B;
       std::swap(A, B);
       index++;
-      return Arc(B, type);
+      const Arc arc(B, type);
+      for(UInt k=0; k<arc.size(); k++)
+        callbackMemory(arc.at(k));
+      return;
     }
 
-    Arc arc;
     auto epoch = std::unique_ptr<Epoch>(Epoch::create(type));
     while(index <= i)
     {
-      arc = Arc(type);
       UInt count;
       file>>beginGroup("arc");
       file>>nameValue("pointCount", count);
-      for(UInt i=0; i<count; i++)
-      {
-        file>>nameValue("epoch", *epoch);
-        arc.push_back(*epoch);
-      }
+      if(isGnssCompact)
+        readGnssReceiverCompact(count, (index == i) ? std::function<void(const Epoch&)>(callbackMemory) : nullptr);
+      else
+        for(UInt k=0; k<count; k++)
+        {
+          file>>nameValue("epoch", *epoch);
+          if(index == i)
+            callbackMemory(*epoch);
+        }
       file>>endGroup("arc");
       index++;
     }
-    return arc;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool InstrumentFile::takePrefetchedArc(UInt arcNo, Arc &arc)
+{
+  try
+  {
+    if(!prefetchTask.valid())
+      return FALSE;
+    std::shared_future<void> task = prefetchTask;
+    prefetchTask = std::shared_future<void>();
+    task.get(); // rethrow exceptions of the background reading
+    Arc arcPrefetched = std::move(prefetchedArc);
+    prefetchedArc = Arc();
+    if(prefetchedArcNo != arcNo)
+      return FALSE;
+    arc = std::move(arcPrefetched);
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::waitPrefetch()
+{
+  if(prefetchTask.valid())
+    prefetchTask.wait();
+  prefetchTask  = std::shared_future<void>();
+  prefetchedArc = Arc();
+}
+
+/***********************************************/
+
+void InstrumentFile::prefetchArc(const std::vector<std::reference_wrapper<InstrumentFile>> &fileList, UInt arcNo)
+{
+  try
+  {
+    if(PREFETCH_MEMORY <= 0)
+      return;
+
+    std::vector<InstrumentFile*> files;
+    Double memory = 0;
+    for(InstrumentFile &file : fileList)
+      if(!file.fileName.empty() && (arcNo < file.arcCount_) && !(file.file.type().empty() || (file.file.type() == FILE_MATRIX_TYPE)) &&
+         (std::find(files.begin(), files.end(), &file) == files.end()))
+      {
+        file.waitPrefetch();
+        if(arcNo < file.index) // would restart at beginning of file
+          continue;
+        memory += file.lastArcMemory;
+        files.push_back(&file);
+      }
+    if(!files.size() || (memory > PREFETCH_MEMORY*1024*1024))
+      return;
+
+    // one I/O thread reads the arcs of all files
+    for(InstrumentFile *file : files)
+      file->prefetchedArcNo = NULLINDEX;
+    std::shared_future<void> task = std::async(std::launch::async, [files, arcNo]()
+    {
+      for(InstrumentFile *file : files)
+      {
+        Arc arc(file->type);
+        file->readArcEpochs(arcNo, [&](const Epoch &epoch) {arc.push_back(epoch);});
+        file->prefetchedArc   = std::move(arc);
+        file->prefetchedArcNo = arcNo;
+      }
+    }).share();
+    for(InstrumentFile *file : files)
+      file->prefetchTask = task;
   }
   catch(std::exception &e)
   {
@@ -871,6 +1062,409 @@ void InstrumentFile::checkArcCount(const std::vector<std::reference_wrapper<cons
   }
 }
 
+/***********************************************/
+/***** GnssReceiver compact encoding ***********/
+/***********************************************/
+
+namespace
+{
+  // unsigned integer with varying length (7 bits per byte)
+  inline void encodeVarint(std::string &buffer, UInt64 x)
+  {
+    while(x >= 0x80)
+    {
+      buffer.push_back(static_cast<char>((x & 0x7f) | 0x80));
+      x >>= 7;
+    }
+    buffer.push_back(static_cast<char>(x));
+  }
+
+  inline UInt64 decodeVarint(const std::string &buffer, UInt &pos)
+  {
+    UInt64 x = 0;
+    for(UInt shift=0; ; shift+=7)
+    {
+      if((pos >= buffer.size()) || (shift > 63))
+        throw(Exception("corrupt compact GNSS receiver data"));
+      const UInt64 byte = static_cast<unsigned char>(buffer[pos++]);
+      x |= (byte & 0x7f) << shift;
+      if(!(byte & 0x80))
+        return x;
+    }
+  }
+
+  // signed differences -> small unsigned values
+  inline UInt64 zigzag(UInt64 x)   {return (x << 1) ^ static_cast<UInt64>(static_cast<Int64>(x) >> 63);}
+  inline UInt64 unzigzag(UInt64 x) {return (x >> 1) ^ (~(x & 1) + 1);}
+
+  inline UInt64 double2bits(Double x)  {UInt64 y; std::memcpy(&y, &x, sizeof(y)); return y;}
+  inline Double bits2double(UInt64 x)  {Double y; std::memcpy(&y, &x, sizeof(y)); return y;}
+
+  // Linear prediction of a double value from the previous epochs.
+  // Computed with the integer bit patterns -> exact and platform independent.
+  class Predictor
+  {
+    UInt64 last, prev;
+    UInt   count, idEpoch;
+
+  public:
+    Predictor() : last(0), prev(0), count(0), idEpoch(NULLINDEX) {}
+
+    UInt64 predict(UInt epoch) const
+    {
+      if((count == 0) || (idEpoch+1 != epoch)) // gap
+        return 0;
+      return (count == 1) ? last : 2*last-prev;
+    }
+
+    void update(UInt64 x, UInt epoch)
+    {
+      count   = (x == 0) ? 0 : ((idEpoch+1 == epoch) ? std::min(count+1, UInt(2)) : 1);
+      prev    = last;
+      last    = x;
+      idEpoch = epoch;
+    }
+  };
+
+  class GnssReceiverCodec
+  {
+    const std::vector<GnssType> &types, &satellites;
+    std::vector<UInt>   idTypes, idSatellites;
+    Int                 mjdInt;
+    Predictor           mjdMod, clockError;
+    std::vector<std::vector<Predictor>> obs; // for each satellite the observation slots
+    UInt                idEpoch;
+
+    // predictor for each observation, the observations of a satellite belong to the types with matching system
+    std::vector<Predictor*> predictors(const GnssReceiverEpoch &epoch, UInt count)
+    {
+      std::vector<std::pair<UInt, UInt>> slots; // (satellite, slot)
+      slots.reserve(count);
+      for(UInt k=0; k<epoch.satellite.size(); k++)
+      {
+        UInt idType = 0;
+        while((idType<epoch.obsType.size()) && (epoch.obsType.at(idType) != epoch.satellite.at(k)))
+          idType++;
+        for(UInt slot=0; (idType<epoch.obsType.size()) && (epoch.obsType.at(idType) == epoch.satellite.at(k)); idType++, slot++)
+          slots.push_back(std::make_pair(idSatellites.at(k), slot));
+      }
+      if(slots.size() != count) // unknown structure -> observations in order
+      {
+        slots.resize(count);
+        for(UInt i=0; i<count; i++)
+          slots.at(i) = std::make_pair(obs.size()-1, i);
+      }
+
+      for(const auto &slot : slots)
+        if(obs.at(slot.first).size() <= slot.second)
+          obs.at(slot.first).resize(slot.second+1);
+      std::vector<Predictor*> pred(count);
+      for(UInt i=0; i<count; i++)
+        pred.at(i) = &obs.at(slots.at(i).first).at(slots.at(i).second);
+      return pred;
+    }
+
+    void encodeValue(std::string &buffer, Predictor &pred, Double x)
+    {
+      const UInt64 bits = double2bits(x);
+      encodeVarint(buffer, zigzag(bits - pred.predict(idEpoch)));
+      pred.update(bits, idEpoch);
+    }
+
+    Double decodeValue(const std::string &buffer, UInt &pos, Predictor &pred)
+    {
+      const UInt64 bits = unzigzag(decodeVarint(buffer, pos)) + pred.predict(idEpoch);
+      pred.update(bits, idEpoch);
+      return bits2double(bits);
+    }
+
+  public:
+    GnssReceiverCodec(const std::vector<GnssType> &types_, const std::vector<GnssType> &satellites_)
+      : types(types_), satellites(satellites_), mjdInt(0), obs(satellites_.size()+1), idEpoch(0) {}
+
+    void encode(const GnssReceiverEpoch &epoch, const std::vector<UInt> &idTypes_, const std::vector<UInt> &idSatellites_, std::string &buffer)
+    {
+      // changes of type and satellite lists
+      const Bool typesChanged      = (idTypes_      != idTypes);
+      const Bool satellitesChanged = (idSatellites_ != idSatellites);
+      encodeVarint(buffer, (typesChanged ? 1 : 0) + (satellitesChanged ? 2 : 0));
+      if(typesChanged)
+      {
+        idTypes = idTypes_;
+        encodeVarint(buffer, idTypes.size());
+        for(UInt id : idTypes)
+          encodeVarint(buffer, id);
+      }
+      if(satellitesChanged)
+      {
+        idSatellites = idSatellites_;
+        encodeVarint(buffer, idSatellites.size());
+        for(UInt id : idSatellites)
+          encodeVarint(buffer, id);
+      }
+
+      encodeVarint(buffer, zigzag(static_cast<UInt64>(static_cast<Int64>(epoch.time.mjdInt()-mjdInt))));
+      mjdInt = epoch.time.mjdInt();
+      encodeValue(buffer, mjdMod,     epoch.time.mjdMod());
+      encodeValue(buffer, clockError, epoch.clockError);
+
+      encodeVarint(buffer, epoch.observation.size());
+      std::vector<Predictor*> pred = predictors(epoch, epoch.observation.size());
+      for(UInt i=0; i<epoch.observation.size(); i++)
+        encodeValue(buffer, *pred.at(i), epoch.observation.at(i));
+      idEpoch++;
+    }
+
+    void decode(const std::string &buffer, UInt &pos, GnssReceiverEpoch &epoch)
+    {
+      auto decodeList = [&](const std::vector<GnssType> &dictionary, std::vector<UInt> &ids, std::vector<GnssType> &list)
+      {
+        ids.resize(decodeVarint(buffer, pos));
+        for(UInt &id : ids)
+          if((id = decodeVarint(buffer, pos)) >= dictionary.size())
+            throw(Exception("corrupt compact GNSS receiver data"));
+        list.resize(ids.size());
+        for(UInt i=0; i<ids.size(); i++)
+          list.at(i) = dictionary.at(ids.at(i));
+      };
+
+      const UInt64 flags = decodeVarint(buffer, pos);
+      if(flags & 1)
+        decodeList(types, idTypes, epoch.obsType);
+      if(flags & 2)
+        decodeList(satellites, idSatellites, epoch.satellite);
+
+      mjdInt += static_cast<Int>(static_cast<Int64>(unzigzag(decodeVarint(buffer, pos))));
+      epoch.time       = Time(mjdInt, decodeValue(buffer, pos, mjdMod));
+      epoch.clockError = decodeValue(buffer, pos, clockError);
+
+      epoch.observation.resize(decodeVarint(buffer, pos));
+      std::vector<Predictor*> pred = predictors(epoch, epoch.observation.size());
+      for(UInt i=0; i<epoch.observation.size(); i++)
+        epoch.observation.at(i) = decodeValue(buffer, pos, *pred.at(i));
+      idEpoch++;
+    }
+  };
+} // end namespace
+
+/***********************************************/
+
+InstrumentFile::Writer::Writer(const FileName &name, Epoch::Type type, UInt arcCount) : type(type), arcCount(arcCount), arcNo(0), pointCount(0), epochNo(0)
+{
+  try
+  {
+    file.open(name, FILE_INSTRUMENT_TYPE);
+    file.comment(Epoch::getTypeName(type));
+    file<<nameValue("satelliteType", static_cast<Int>(type));
+    file<<nameValue("arcCount",      arcCount);
+    isGnssCompact = (type == Epoch::GNSSRECEIVER) && (file.outArchive().archiveType() == OutArchive::BINARY);
+    if(isGnssCompact)
+      return;
+    const std::string comment = Epoch::fileFormatString(type);
+    file.comment(comment);
+    file.comment(std::string(comment.size(), '='));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::Writer::writeArc(const Arc &arc)
+{
+  try
+  {
+    beginArc(arc.size());
+    for(UInt i=0; i<arc.size(); i++)
+      writeEpoch(arc.at(i));
+    endArc();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::Writer::beginArc(UInt pointCount)
+{
+  try
+  {
+    if(arcNo >= arcCount)
+      throw(Exception("more arcs than arcCount ("+arcCount%"%i) written to <"s+file.fileName().str()+">"));
+    this->pointCount = pointCount;
+    epochNo = 0;
+
+    if(isGnssCompact)
+    {
+      gnssArcs.push_back(Arc(type));
+      return;
+    }
+
+    file<<beginGroup("arc");
+    file<<nameValue("pointCount", pointCount);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::Writer::writeEpoch(const Epoch &epoch)
+{
+  try
+  {
+    if(epochNo >= pointCount)
+      throw(Exception("more epochs than pointCount ("+pointCount%"%i) written to arc "s+arcNo%"%i of <"s+file.fileName().str()+">"));
+    if(epoch.getType() != type)
+      throw(Exception("epoch of type "+epoch.getTypeName()+" written to a file of type "+Epoch::getTypeName(type)));
+    epochNo++;
+
+    if(isGnssCompact)
+    {
+      gnssArcs.back().push_back(epoch);
+      return;
+    }
+
+    file<<beginGroup("epoch");
+    epoch.save(file.outArchive());
+    file<<endGroup("epoch");
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::Writer::endArc()
+{
+  try
+  {
+    if(epochNo != pointCount)
+      throw(Exception(epochNo%"%i epochs written to arc "s+arcNo%"%i of <"s+file.fileName().str()+">, but pointCount is "+pointCount%"%i"s));
+    arcNo++;
+    if(!isGnssCompact)
+      file<<endGroup("arc");
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::Writer::close()
+{
+  try
+  {
+    if(arcNo != arcCount)
+      throw(Exception(arcNo%"%i arcs written to <"s+file.fileName().str()+">, but arcCount is "+arcCount%"%i"s));
+    if(isGnssCompact)
+    {
+      std::vector<const Arc*> arcs;
+      for(const Arc &arc : gnssArcs)
+        arcs.push_back(&arc);
+      writeGnssReceiverCompact(file, arcs);
+      gnssArcs.clear();
+    }
+    file.close();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::writeGnssReceiverCompact(OutFileArchive &file, const std::vector<const Arc*> &arcList)
+{
+  try
+  {
+    // dictionary of types and satellites
+    std::vector<GnssType> types, satellites;
+    std::map<UInt64, UInt> idType, idSatellite;
+    auto index = [](std::map<UInt64, UInt> &ids, std::vector<GnssType> &dictionary, GnssType type)
+    {
+      auto iter = ids.find(type.type);
+      if(iter != ids.end())
+        return iter->second;
+      ids[type.type] = dictionary.size();
+      dictionary.push_back(type);
+      return dictionary.size()-1;
+    };
+
+    std::vector<std::vector<std::vector<UInt>>> idTypes(arcList.size()), idSatellites(arcList.size());
+    for(UInt arcNo=0; arcNo<arcList.size(); arcNo++)
+    {
+      idTypes.at(arcNo).resize(arcList.at(arcNo)->size());
+      idSatellites.at(arcNo).resize(arcList.at(arcNo)->size());
+      for(UInt i=0; i<arcList.at(arcNo)->size(); i++)
+      {
+        const GnssReceiverEpoch &epoch = dynamic_cast<const GnssReceiverEpoch&>(arcList.at(arcNo)->at(i));
+        for(GnssType type : epoch.obsType)
+          idTypes.at(arcNo).at(i).push_back(index(idType, types, type));
+        for(GnssType type : epoch.satellite)
+          idSatellites.at(arcNo).at(i).push_back(index(idSatellite, satellites, type));
+      }
+    }
+    file<<nameValue("types",      types);
+    file<<nameValue("satellites", satellites);
+
+    for(UInt arcNo=0; arcNo<arcList.size(); arcNo++)
+    {
+      GnssReceiverCodec codec(types, satellites);
+      std::string buffer;
+      for(UInt i=0; i<arcList.at(arcNo)->size(); i++)
+        codec.encode(dynamic_cast<const GnssReceiverEpoch&>(arcList.at(arcNo)->at(i)), idTypes.at(arcNo).at(i), idSatellites.at(arcNo).at(i), buffer);
+      file<<beginGroup("arc");
+      file<<nameValue("pointCount", arcList.at(arcNo)->size());
+      file<<nameValue("data",       buffer);
+      file<<endGroup("arc");
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void InstrumentFile::readGnssReceiverCompact(UInt count, const std::function<void(const Epoch &epoch)> &callback)
+{
+  try
+  {
+    std::string buffer;
+    file>>nameValue("data", buffer);
+    if(!callback)
+      return;
+
+    GnssReceiverCodec codec(gnssTypes, gnssSatellites);
+    GnssReceiverEpoch epoch;
+    UInt pos = 0;
+    for(UInt i=0; i<count; i++)
+    {
+      codec.decode(buffer, pos, epoch);
+      callback(epoch);
+    }
+    if(pos != buffer.size())
+      throw(Exception("corrupt compact GNSS receiver data"));
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
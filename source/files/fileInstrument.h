@@ -57,11 +57,17 @@ groops instrument version=20200123
  54588.001273148148356995 -5.073902746728868224e+05  7.819835205798950639e-01  1.874226146744964808e-03
  54588.001331018518612836 -5.073863413272026228e+05  7.913547196412918927e-01  1.874173804634685515e-03
 \end{verbatim}
+
+GNSSRECEIVER observations in binary format (\verb|*.dat|, \verb|*.dat.gz|) are written in a compact encoding.
+The observation types and satellites are stored once as dictionary in the file header. Each epoch contains only the changes
+of the type and satellite lists, the times, clock errors, and observations are stored lossless as
+varying length differences to a linear prediction from the previous epochs.
 )";
 #endif
 
 /***********************************************/
 
+#include <future>
 #include "base/import.h"
 #include "base/gnssType.h"
 #include "inputOutput/fileArchive.h"
@@ -318,6 +324,10 @@ public:
 
   /** @brief Log information about arc size, number of epochs and so on. */
   static void printStatistics(const std::vector<Arc> &arcList);
+
+  /** @brief Log information about arc size, number of epochs and so on.
+  * The arcs are given by the times of their epochs only. */
+  static void printStatistics(const std::vector<std::vector<Time>> &timesList);
 };
 
 /***** CLASS ***********************************/
@@ -411,9 +421,62 @@ class InstrumentFile
   UInt          arcCount_;
   UInt          index;
   Matrix        A; // if a matrix file is open
+  Bool          isGnssCompact; // GNSSRECEIVER in compact binary encoding
+  std::vector<GnssType> gnssTypes, gnssSatellites; // dictionary of compact encoding
+  std::shared_future<void> prefetchTask;   // background reading
+  Arc           prefetchedArc;
+  UInt          prefetchedArcNo;
+  UInt          lastArcMemory; // estimated memory of the last read arc [Byte]
+
+  static void writeGnssReceiverCompact(OutFileArchive &file, const std::vector<const Arc*> &arcList);
+  void readGnssReceiverCompact(UInt count, const std::function<void(const Epoch &epoch)> &callback);
+  void openFile(const FileName &name);
+  void closeFile();
+  void readArcEpochs(UInt arcNo, const std::function<void(const Epoch &epoch)> &callback);
+  Bool takePrefetchedArc(UInt arcNo, Arc &arc);
+  void waitPrefetch();
 
 public:
-  InstrumentFile() : type(Epoch::EMPTY), arcCount_(0) {}       //!< Default constructor.
+  /** @brief Write a file arc by arc or epoch by epoch.
+  * The epochs need not be kept in memory, but the number of arcs and epochs must be known in advance.
+  * The file is the same as written with InstrumentFile::write() at once.
+  * Exception: GNSS receiver arcs in binary files are kept until close(),
+  * as the dictionary of the compact encoding is written in front of the arcs. */
+  class Writer
+  {
+    OutFileArchive   file;
+    Epoch::Type      type;
+    UInt             arcCount, arcNo;
+    UInt             pointCount, epochNo;
+    Bool             isGnssCompact;
+    std::vector<Arc> gnssArcs;
+
+    friend class InstrumentFile;
+
+  public:
+    Writer(const FileName &name, Epoch::Type type, UInt arcCount);
+    Writer(const Writer &) = delete;
+    Writer &operator=(const Writer &) = delete;
+
+    /** @brief Write the next arc. */
+    void writeArc(const Arc &arc);
+
+    /** @brief Start the next arc with @p pointCount epochs, which are written with writeEpoch(). */
+    void beginArc(UInt pointCount);
+
+    /** @brief Write the next epoch of the current arc. */
+    void writeEpoch(const Epoch &epoch);
+
+    /** @brief Finish the current arc.
+    * An Exception is thrown if the number of written epochs differs from pointCount. */
+    void endArc();
+
+    /** @brief Finish the file.
+    * An Exception is thrown if the number of written arcs differs from arcCount. */
+    void close();
+  };
+
+  InstrumentFile() : type(Epoch::EMPTY), arcCount_(0), isGnssCompact(FALSE), prefetchedArcNo(NULLINDEX), lastArcMemory(0) {} //!< Default constructor.
   explicit InstrumentFile(const FileName &name) {open(name);}  //!< Constructor.
   InstrumentFile(const InstrumentFile &) = delete;             //!< Disallow copy constructor
   InstrumentFile &operator=(const InstrumentFile &x) = delete; //!< Disallow copying
@@ -445,11 +508,24 @@ public:
   * If the file is not open, a empty Arc is returned. */
   Arc readArc(UInt arcNo);
 
+  /** @brief Read a single Arc epoch by epoch.
+  * Each epoch is decoded directly and given to @p callback without creating the Arc.
+  * The operation is faster, if the arcs in read in increasing order. */
+  void readArc(UInt arcNo, const std::function<void(const Epoch &epoch)> &callback);
+
   /** @brief Test number of arcs of multiple files.
   * Test wether files are divided into the same number of arcs otherwise an expection is thrown.
   * Files which are not open are ignored. */
   static void checkArcCount(const std::vector<std::reference_wrapper<const InstrumentFile>> &fileList);
 
+  /** @brief Read the arc @p arcNo of multiple files in a background thread.
+  * A following readArc(arcNo) returns the prefetched arc without waiting for I/O.
+  * Typically called after reading arc k with k+1, which is the next arc of this process
+  * in Parallel::forEachInterval as long as the process stays within its interval.
+  * The prefetch is skipped, if the estimated memory (from the last read arcs) exceeds PREFETCH_MEMORY.
+  * Files which are not open are ignored. */
+  static void prefetchArc(const std::vector<std::reference_wrapper<InstrumentFile>> &fileList, UInt arcNo);
+
   /** @brief Read all arcs and concatenate to one arc. */
   static Arc read(const FileName &name);
 
@@ -466,26 +542,18 @@ public:
   {
     try
     {
-      OutFileArchive file(name, FILE_INSTRUMENT_TYPE);
-      Epoch::Type type = Arc::getType(arcList);
-      file.comment(Epoch::getTypeName(type));
-      file<<nameValue("satelliteType", static_cast<Int>(type));
-      file<<nameValue("arcCount",      arcList.size());
-      const std::string comment = Epoch::fileFormatString(type);
-      file.comment(comment);
-      file.comment(std::string(comment.size(), '='));
-      for(const Arc &arc : arcList)
+      Writer writer(name, Arc::getType(arcList), arcList.size());
+      if(writer.isGnssCompact)
       {
-        file<<beginGroup("arc");
-        file<<nameValue("pointCount", arc.size());
-        for(UInt i=0; i<arc.size(); i++)
-        {
-          file<<beginGroup("epoch");
-          arc.at(i).save(file.outArchive());
-          file<<endGroup("epoch");
-        }
-        file<<endGroup("arc");
+        std::vector<const Arc*> arcs;
+        for(const Arc &arc : arcList)
+          arcs.push_back(&arc);
+        writeGnssReceiverCompact(writer.file, arcs);
+        return;
       }
+      for(const Arc &arc : arcList)
+        writer.writeArc(arc);
+      writer.close();
     }
     catch(std::exception &e)
     {
@@ -37,6 +37,21 @@ void writeFileMatrix(const FileName &fileName, const const_MatrixSlice &x)
 
 /***********************************************/
 
+void writeFileMatrix(const FileName &fileName, const MatrixPacked &x)
+{
+  try
+  {
+    OutFileArchive file(fileName, FILE_MATRIX_TYPE);
+    file<<nameValue("matrix", x);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void readFileMatrix(const FileName &fileName, Matrix &x)
 {
   try
@@ -56,3 +71,20 @@ void readFileMatrix(const FileName &fileName, Matrix &x)
 }
 
 /***********************************************/
+
+void readFileMatrix(const FileName &fileName, MatrixPacked &x)
+{
+  try
+  {
+    InFileArchive file(fileName, ""/*arbitrary type*/);
+    if(!file.type().empty() && (file.type() != FILE_MATRIX_TYPE))
+      throw(Exception("file type is '"+file.type()+"' but must be '"+FILE_MATRIX_TYPE+"'"));
+    file>>nameValue("matrix", x);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -40,6 +40,7 @@ LowerSymmetricMatrix( 4 x 4 )
 /***********************************************/
 
 #include "base/matrix.h"
+#include "base/matrixPacked.h"
 #include "inputOutput/fileName.h"
 
 /** @addtogroup filesGroup */
@@ -57,6 +58,15 @@ void writeFileMatrix(const FileName &fileName, const const_MatrixSlice &x);
 /** @brief Read from a Matrix file. */
 void readFileMatrix(const FileName &fileName, Matrix &x);
 
+/** @brief Write a symmetric or triangular matrix in packed format into a Matrix file.
+* The file format is the same as for symmetric or triangular matrices. */
+void writeFileMatrix(const FileName &fileName, const MatrixPacked &x);
+
+/** @brief Read a symmetric or triangular matrix from a Matrix file in packed format.
+* Binary files are read directly into packed format without a temporary full matrix.
+* GENERAL matrices are interpreted as SYMMETRIC (upper triangle). */
+void readFileMatrix(const FileName &fileName, MatrixPacked &x);
+
 /// @}
 
 /***********************************************/
@@ -14,6 +14,7 @@
 #define DOCSTRING_FILEFORMAT_NormalEquation
 
 #include "base/import.h"
+#include "base/matrixPacked.h"
 #include "inputOutput/fileArchive.h"
 #include "parallel/matrixDistributed.h"
 #include "files/fileFormatRegister.h"
@@ -83,6 +84,28 @@ void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, cons
 
 /***********************************************/
 
+void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, const MatrixPacked &N, const Matrix &n)
+{
+  try
+  {
+    Bool writeBlock = N.size() && std::any_of(N.field(), N.field()+N.size(), [](Double x) {return x != 0.;});
+    // info file
+    info.blockIndex = {0, N.rows()};
+    info.usedBlocks = identityMatrix(writeBlock ? 1 : 0);
+    writeInfoFile(name, info, n);
+
+    // normal matrix
+    if(writeBlock)
+      writeFileMatrix(name, N);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, const std::vector<std::vector<Matrix>> &N, const Matrix &n)
 {
   try
@@ -273,6 +296,45 @@ void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, Matr
 
 /***********************************************/
 
+void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, MatrixPacked &N, Matrix &n)
+{
+  try
+  {
+    readInfoFile(name, info, n);
+    const std::vector<UInt> &blockIndex = info.blockIndex;
+
+    // read normal equation
+    if(blockIndex.size() == 2)
+    {
+      readFileMatrix(name, N);
+      if(N.rows() != blockIndex.back())
+        throw(Exception("<"+name.str()+"> dimension error"));
+      N.setType(Matrix::SYMMETRIC);
+    }
+    else
+    {
+      // only one block in full format at once
+      N = MatrixPacked(blockIndex.back(), Matrix::SYMMETRIC);
+      for(UInt i=0; i<blockIndex.size()-1; i++)
+        for(UInt k=i; k<blockIndex.size()-1; k++)
+          if(!info.usedBlocks.size() || (info.usedBlocks.size() && info.usedBlocks(i,k) > 0))
+          {
+            Matrix M;
+            readFileMatrix(name.appendBaseName("."+i%"%02i-"s+k%"%02i"s), M);
+            for(UInt s=0; s<M.columns(); s++)
+              for(UInt z=0; z<((i==k) ? s+1 : M.rows()); z++)
+                N(blockIndex.at(i)+z, blockIndex.at(k)+s) = M(z,s);
+          }
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, MatrixDistributed &normal, Matrix &n)
 {
   try
@@ -75,6 +75,10 @@ void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, cons
 /** @brief Write a system of normal equations. */
 void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, const std::vector<std::vector<Matrix>> &N, const Matrix &n);
 
+class MatrixPacked;
+/** @brief Write a system of normal equations with a normal matrix in packed format. */
+void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, const MatrixPacked &N, const Matrix &n);
+
 class MatrixDistributed;
 /** @brief Write a system of normal equations.
 * Must be called on every process.
@@ -90,6 +94,10 @@ void writeFileNormalEquation(const FileName &name, NormalEquationInfo info, cons
 /** @brief Read a system of normal equations. */
 void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, Matrix &N, Matrix &n);
 
+/** @brief Read a system of normal equations with the normal matrix in packed format.
+* Needs about half of the memory of a full normal matrix. */
+void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, MatrixPacked &N, Matrix &n);
+
 /** @brief Write a system of normal equations.
 * Must be called on every process. */
 void readFileNormalEquation(const FileName &name, NormalEquationInfo &info, MatrixDistributed &normal, Matrix &n);
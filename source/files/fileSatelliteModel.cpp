@@ -314,6 +314,51 @@ void SatelliteModel::Surface::accelerationPressure(const Vector3d &direction, Do
 
 /***********************************************/
 
+SatelliteModel::SurfaceArrays::SurfaceArrays(const std::vector<Surface> &surfaces)
+{
+  try
+  {
+    if(!isSupported(surfaces))
+      throw(Exception("only plates and cylinders are supported"));
+
+    const UInt count = surfaces.size();
+    for(auto x : {&normalX, &normalY, &normalZ, &area, &absorptionVisible, &absorptionInfrared, &diffusionVisible, &diffusionInfrared,
+                  &reflexionVisible, &reflexionInfrared, &factorDiffusion, &factorReflexion, &factorThermal})
+      x->resize(count);
+
+    for(UInt i=0; i<count; i++)
+    {
+      const Surface &surface = surfaces.at(i);
+      normalX.at(i)            = surface.normal.x();
+      normalY.at(i)            = surface.normal.y();
+      normalZ.at(i)            = surface.normal.z();
+      area.at(i)               = surface.area;
+      absorptionVisible.at(i)  = surface.absorptionVisible;
+      absorptionInfrared.at(i) = surface.absorptionInfrared;
+      diffusionVisible.at(i)   = surface.diffusionVisible;
+      diffusionInfrared.at(i)  = surface.diffusionInfrared;
+      reflexionVisible.at(i)   = surface.reflexionVisible;
+      reflexionInfrared.at(i)  = surface.reflexionInfrared;
+      factorDiffusion.at(i)    = (surface.type == Surface::PLATE) ? 2./3. : PI/6.;
+      factorReflexion.at(i)    = (surface.type == Surface::PLATE) ? 2.    : 4./3.;
+      factorThermal.at(i)      = surface.hasThermalReemission ? factorDiffusion.at(i) : 0.;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool SatelliteModel::SurfaceArrays::isSupported(const std::vector<Surface> &surfaces)
+{
+  return std::all_of(surfaces.begin(), surfaces.end(), [](const Surface &s) {return (s.type == Surface::PLATE) || (s.type == Surface::CYLINDER);});
+}
+
+/***********************************************/
+
 template<> void save(OutArchive &ar, const SatelliteModel::Surface &x)
 {
   try
@@ -446,6 +491,82 @@ Vector3d SatelliteModel::accelerationPressure(const Vector3d &direction, Double
 
 /***********************************************/
 
+std::vector<Vector3d> SatelliteModel::accelerationPressure(const std::vector<Vector3d> &direction, const std::vector<Double> &visible, const std::vector<Double> &infrared) const
+{
+  try
+  {
+    if(mass == 0.)
+      throw(Exception("No SatelliteModel given: "+satelliteName));
+    if((visible.size() != direction.size()) || (infrared.size() != direction.size()))
+      throw(Exception("size mismatch: direction ("s+direction.size()%"%i), visible ("s+visible.size()%"%i), infrared ("s+infrared.size()%"%i)"s));
+
+    const UInt count = direction.size();
+    std::vector<Vector3d> acc(count);
+    if(!count)
+      return acc;
+
+    // e.g. spheres: no batched formula
+    if(!SurfaceArrays::isSupported(surfaces))
+    {
+      for(UInt k=0; k<count; k++)
+        acc.at(k) = accelerationPressure(direction.at(k), visible.at(k), infrared.at(k));
+      return acc;
+    }
+
+    const SurfaceArrays s(surfaces);
+    std::vector<Double> dx(count), dy(count), dz(count);
+    for(UInt k=0; k<count; k++)
+    {
+      dx[k] = direction[k].x();
+      dy[k] = direction[k].y();
+      dz[k] = direction[k].z();
+    }
+    const Double *vis = visible.data();
+    const Double *ir  = infrared.data();
+
+    // same formulas as Surface::accelerationPressure, facing away (cosPhi<=0) gives zero contribution
+    std::vector<Double> ax(count, 0.), ay(count, 0.), az(count, 0.);
+    for(UInt i=0; i<s.size(); i++)
+    {
+      const Double nx = s.normalX[i], ny = s.normalY[i], nz = s.normalZ[i], area = s.area[i];
+      const Double rv = s.reflexionVisible[i],  ri = s.reflexionInfrared[i];
+      const Double dv = s.diffusionVisible[i],  di = s.diffusionInfrared[i];
+      const Double av = s.absorptionVisible[i], ai = s.absorptionInfrared[i];
+      const Double fDiffusion = s.factorDiffusion[i], fReflexion = s.factorReflexion[i], fThermal = s.factorThermal[i];
+      for(UInt k=0; k<count; k++)
+      {
+        const Double cosPhi     = -(dx[k]*nx + dy[k]*ny + dz[k]*nz);
+        const Double areaCos    = area * std::max(cosPhi, 0.);
+        const Double reflexion  = rv * vis[k] + ri * ir[k];
+        const Double diffusion  = dv * vis[k] + di * ir[k];
+        const Double absorption = av * vis[k] + ai * ir[k];
+        const Double fd = areaCos*(absorption+diffusion);
+        const Double fn = areaCos*(fDiffusion*diffusion+fReflexion*cosPhi*reflexion);
+        const Double ft = areaCos*(fThermal*absorption);
+        ax[k] = (ax[k] + (fd*dx[k] - fn*nx)) - ft*nx;
+        ay[k] = (ay[k] + (fd*dy[k] - fn*ny)) - ft*ny;
+        az[k] = (az[k] + (fd*dz[k] - fn*nz)) - ft*nz;
+      }
+    }
+
+    for(UInt k=0; k<count; k++)
+    {
+      Vector3d a(ax[k], ay[k], az[k]);
+      for(auto module : modules)
+        module->accelerationPressure(*this, direction[k], vis[k], ir[k], a);
+      acc[k] = (1./mass) * a;
+    }
+
+    return acc;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Vector3d SatelliteModel::accelerationThrust() const
 {
   try
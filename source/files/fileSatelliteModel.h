@@ -132,6 +132,26 @@ public:
     void     accelerationPressure(const Vector3d &direction, Double visible, Double infrared, Vector3d &acc) const;
   };
 
+  /** @brief Surfaces as structure of arrays.
+  * Only PLATE and CYLINDER surfaces are supported.
+  * The factors of the type dependent formulas are precomputed, so the same code applies to all surfaces. */
+  class SurfaceArrays
+  {
+  public:
+    std::vector<Double> normalX, normalY, normalZ;
+    std::vector<Double> area;
+    std::vector<Double> absorptionVisible, absorptionInfrared;
+    std::vector<Double> diffusionVisible,  diffusionInfrared;
+    std::vector<Double> reflexionVisible,  reflexionInfrared;
+    std::vector<Double> factorDiffusion, factorReflexion, factorThermal; //!< PLATE: 2/3, 2, 2/3 (0 without thermal reemission), CYLINDER: PI/6, 4/3, PI/6
+
+    explicit SurfaceArrays(const std::vector<Surface> &surfaces);
+    UInt size() const {return area.size();}
+
+    /** @brief Are all @a surfaces supported? */
+    static Bool isSupported(const std::vector<Surface> &surfaces);
+  };
+
   SatelliteModel(); //!< Constructor.
  ~SatelliteModel(); //!< Destructor.
   SatelliteModel &operator=(const SatelliteModel &x) = delete; //!< Disallow copying.
@@ -168,6 +188,16 @@ public:
   * @return acceleration [m/s^2] in satellite frame (SRF) */
   Vector3d accelerationPressure(const Vector3d &direction, Double visible, Double infrared) const;
 
+  /** @brief Acceleration of satellite due to solar radiation pressure/albedo for many incident directions.
+  * Same as @a accelerationPressure for each element, but all with the current state of the satellite
+  * (e.g. all albedo sources of one epoch, or many epochs/attitudes if no module changes the state).
+  * The surfaces are processed as @a SurfaceArrays in loops over the directions, which the compiler vectorizes.
+  * @param direction unit vectors of incoming radiation (in satellite frame, SRF)
+  * @param visible magnitudes of incident visible radiation [N/m^2]
+  * @param infrared magnitudes of incident infrared radiation [N/m^2]
+  * @return accelerations [m/s^2] in satellite frame (SRF) */
+  std::vector<Vector3d> accelerationPressure(const std::vector<Vector3d> &direction, const std::vector<Double> &visible, const std::vector<Double> &infrared) const;
+
   /** @brief Acceleration of satellite due to thrust. */
   Vector3d accelerationThrust() const;
 };
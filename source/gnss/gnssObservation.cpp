@@ -305,7 +305,7 @@ void Gnss::ObservationEquation::compute(const Observation &observation, const Re
     // antenna correction
     // ------------------
     l -= receiver->antennaVariations(idEpoch, azimutRecvAnt,  elevationRecvAnt,  types);
-    l -= T * transmitter->antennaVariations(idEpoch, azimutTrans, elevationTrans, typesTransmitted);
+    matMult(-1., T, transmitter->antennaVariations(idEpoch, azimutTrans, elevationTrans, typesTransmitted), l);
 
     // reduce ionospheric effects
     // --------------------------
@@ -14,6 +14,7 @@
 
 #include "base/import.h"
 #include "base/planets.h"
+#include "base/matrixSmall.h"
 #include "parser/dataVariables.h"
 #include "inputOutput/logging.h"
 #include "config/config.h"
@@ -164,6 +165,12 @@ void GnssParametrizationIonosphere::aprioriParameter(const Gnss::NormalEquationI
 
 /***********************************************/
 
+// capacity for the per observation algebra on the stack (otherwise Matrix is used)
+typedef MatrixSmall<33, 2>   MatrixSmallTec; // observations (+ constraint) x TEC parameters
+typedef MatrixSmall<33, 128> MatrixSmallObs; // observations (+ constraint) x columns of l, A, B
+
+/***********************************************/
+
 void GnssParametrizationIonosphere::eliminateTecParameter(const Gnss::NormalEquationInfo &normalEquationInfo, Gnss::ObservationEquation &eqn) const
 {
   try
@@ -173,6 +180,35 @@ void GnssParametrizationIonosphere::eliminateTecParameter(const Gnss::NormalEqua
 
     if(sigmaSTEC && (normalEquationInfo.estimationType & Gnss::NormalEquationInfo::CONSTRAINT_IONOSPHERE_STEC))
     {
+      const UInt rows = 1+eqn.B.rows();
+      if(MatrixSmallTec::fits(rows, eqn.B.columns()) && MatrixSmallObs::fits(rows, eqn.l.columns()+eqn.A.columns()+eqn.B.columns()))
+      {
+        // l, A, and B extended by one row at beginning
+        MatrixSmallTec B(rows, eqn.B.columns());
+        MatrixSmallObs lAB(rows, eqn.l.columns()+eqn.A.columns()+eqn.B.columns());
+        B.copy(eqn.B, 1, 0);
+        lAB.copy(eqn.l, 1, 0);
+        lAB.copy(eqn.A, 1, eqn.l.columns());
+        lAB.copy(eqn.B, 1, eqn.l.columns()+eqn.A.columns());
+
+        // constrain STEC;
+        lAB(0, 0) = -1./sigmaSTEC * eqn.dSTEC; // constrain towards zero (0-x0)
+        B(0, 0)   =  1./sigmaSTEC;             // in TECU
+
+        // eliminate STEC;
+        eliminationParameter(B, lAB);
+        if(eqn.l.rows() != lAB.rows()) // same size for one TEC parameter
+        {
+          eqn.l = Vector(lAB.rows());
+          eqn.A = Matrix(lAB.rows(), eqn.A.columns());
+          eqn.B = Matrix(lAB.rows(), eqn.B.columns());
+        }
+        lAB.copyTo(0, 0, eqn.l);
+        lAB.copyTo(0, eqn.l.columns(), eqn.A);
+        lAB.copyTo(0, eqn.l.columns()+eqn.A.columns(), eqn.B);
+        return;
+      }
+
       // extend l, A, and B by one row at beginning
       for(Matrix &A : std::vector<std::reference_wrapper<Matrix>>{eqn.l, eqn.A, eqn.B})
       {
@@ -196,7 +232,20 @@ void GnssParametrizationIonosphere::eliminateTecParameter(const Gnss::NormalEqua
     else
     {
       // eliminate ionosphere parameter
-      eliminationParameter(eqn.B, {eqn.A, eqn.l});
+      if(MatrixSmallTec::fits(eqn.B.rows(), eqn.B.columns()) && MatrixSmallObs::fits(eqn.B.rows(), eqn.A.columns()+eqn.l.columns()))
+      {
+        MatrixSmallTec B(eqn.B);
+        MatrixSmallObs Al(eqn.B.rows(), eqn.A.columns()+eqn.l.columns());
+        Al.copy(eqn.A, 0, 0);
+        Al.copy(eqn.l, 0, eqn.A.columns());
+        eliminationParameter(B, Al);
+        eqn.A = Matrix(Al.rows(), eqn.A.columns());
+        eqn.l = Vector(Al.rows());
+        Al.copyTo(0, 0, eqn.A);
+        Al.copyTo(0, eqn.A.columns(), eqn.l);
+      }
+      else
+        eliminationParameter(eqn.B, {eqn.A, eqn.l});
       eqn.B = Matrix();
     }
   }
@@ -216,9 +265,69 @@ void GnssParametrizationIonosphere::updateAndEliminateTecParameter(const Gnss::N
     if(!eqn.B.size())
       return;
 
+    const Bool constraint = sigmaSTEC && (normalEquationInfo.estimationType & Gnss::NormalEquationInfo::CONSTRAINT_IONOSPHERE_STEC);
+    const UInt row0       = constraint ? 1 : 0;
+    const UInt rows       = row0+eqn.B.rows();
+    const UInt countTec   = eqn.B.columns();
     Matrix B = eqn.B;
     eqn.B = Matrix();
-    if(sigmaSTEC && (normalEquationInfo.estimationType & Gnss::NormalEquationInfo::CONSTRAINT_IONOSPHERE_STEC))
+
+    auto updateTec = [&](Double dTec)
+    {
+      if((std::fabs(dTec) > maxChangeTec) && (norm(eqn.sigma-eqn.sigma0) < 1e-8)) // without outlier
+      {
+        maxChangeTec     = std::fabs(dTec);
+        infoMaxChangeTec = "  "+eqn.receiver->name()+"."+eqn.transmitter->name()+":  "+eqn.timeRecv.dateTimeStr()+" tecChange = "
+                          + dTec%"%6.2f TECU = "s+(dTec*Ionosphere::Ap/pow((GnssType::L2+GnssType::GPS).frequency(),2)*1000)%"%7.1f mm = "s
+                          + (dTec/LIGHT_VELOCITY*1e9)%"%8.3f ns"s;
+      }
+    };
+
+    if(MatrixSmallTec::fits(rows, countTec) && MatrixSmallObs::fits(rows, AWz.columns()))
+    {
+      MatrixSmallTec Bs(rows, countTec);
+      MatrixSmallTec Ws(rows, 1);
+      MatrixSmallObs AWzs(rows, AWz.columns());
+      Bs.copy(B, row0, 0);
+      Ws.copy(We, row0, 0);
+      AWzs.copy(AWz, row0, 0);
+      if(constraint)
+      {
+        // constrain STEC;
+        Ws(0, 0) = -1./sigmaSTEC * eqn.dSTEC; // constrain towards zero (0-x0)
+        Bs(0, 0) =  1./sigmaSTEC;             // in TECU
+      }
+
+      // estimate and eliminate STEC parameter
+      const auto tau = QR_decomposition(Bs);
+      QTransMult(Bs, tau, Ws);
+      triangularSolve(Bs, Ws);
+      Vector dTec(countTec);
+      Ws.copyTo(0, 0, dTec);
+      eqn.receiver->observation(eqn.transmitter->idTrans(), eqn.idEpoch)->updateParameter(dTec); // ionosphere parameter
+      updateTec(dTec(0));
+
+      // remove STEC from residuals
+      for(UInt i=0; i<countTec; i++)
+        Ws(i, 0) = 0.;
+      QMult(Bs, tau, Ws);
+
+      // influence of B parameters = B(B'B)^(-1)B'
+      QTransMult(Bs, tau, AWzs);
+      for(UInt k=0; k<AWzs.columns(); k++)
+        for(UInt i=0; i<countTec; i++)
+          AWzs(i, k) = 0.;
+      for(UInt i=0; i<countTec; i++)
+        AWzs(i, i) = 1.0;
+      QMult(Bs, tau, AWzs);
+
+      // remove constraint row
+      Ws.copyTo(row0, 0, We);
+      AWzs.copyTo(row0, 0, AWz);
+      return;
+    }
+
+    if(constraint)
     {
       // extend We, AWz, and B by one row at beginning
       for(Matrix &A : std::vector<std::reference_wrapper<Matrix>>{We, AWz, B})
@@ -238,14 +347,7 @@ void GnssParametrizationIonosphere::updateAndEliminateTecParameter(const Gnss::N
     QTransMult(B, tau, We);
     triangularSolve(1., B.row(0,B.columns()), We.row(0,B.columns()));
     eqn.receiver->observation(eqn.transmitter->idTrans(), eqn.idEpoch)->updateParameter(We.row(0,B.columns())); // ionosphere parameter
-
-    if((std::fabs(We(0)) > maxChangeTec) && (norm(eqn.sigma-eqn.sigma0) < 1e-8)) // without outlier
-    {
-      maxChangeTec     = std::fabs(We(0));
-      infoMaxChangeTec = "  "+eqn.receiver->name()+"."+eqn.transmitter->name()+":  "+eqn.timeRecv.dateTimeStr()+" tecChange = "
-                        + We(0)%"%6.2f TECU = "s+(We(0)*Ionosphere::Ap/pow((GnssType::L2+GnssType::GPS).frequency(),2)*1000)%"%7.1f mm = "s
-                        + (We(0)/LIGHT_VELOCITY*1e9)%"%8.3f ns"s;
-    }
+    updateTec(We(0));
 
     // remove STEC from residuals
     We.row(0,B.columns()).setNull();
@@ -258,7 +360,7 @@ void GnssParametrizationIonosphere::updateAndEliminateTecParameter(const Gnss::N
       AWz(i,i) = 1.0;
     QMult(B, tau, AWz);
 
-    if(sigmaSTEC && (normalEquationInfo.estimationType & Gnss::NormalEquationInfo::CONSTRAINT_IONOSPHERE_STEC))
+    if(constraint)
     {
       // remove first row
       We  = We.row (1, We.rows() -1);
@@ -572,37 +572,38 @@ void Gnss::Receiver::readObservations(InstrumentFile &fileReceiver,
     UInt idEpoch = 0;
     for(UInt arcNo=0; arcNo<fileReceiver.arcCount(); arcNo++)
     {
-      GnssReceiverArc arc = fileReceiver.readArc(arcNo);
-      for(UInt arcEpoch=0; arcEpoch<arc.size(); arcEpoch++)
+      // epochs are decoded directly without creating the arc
+      fileReceiver.readArc(arcNo, [&](const Epoch &epoch_)
       {
+        const GnssReceiverEpoch &epoch = static_cast<const GnssReceiverEpoch&>(epoch_);
         // search time slot
-        while((idEpoch < times.size()) && (times.at(idEpoch)+timeMargin < arc.at(arcEpoch).time))
+        while((idEpoch < times.size()) && (times.at(idEpoch)+timeMargin < epoch.time))
           idEpoch++;
         if(idEpoch >= times.size())
-          break;
-        if(arc.at(arcEpoch).time+timeMargin < times.at(idEpoch))
-          continue;
-        times.at(idEpoch) = arc.at(arcEpoch).time;
-//         clk.at(idEpoch)   = arc.at(arcEpoch).clockError;
-        observationTimes.push_back(arc.at(arcEpoch).time);
+          return;
+        if(epoch.time+timeMargin < times.at(idEpoch))
+          return;
+        times.at(idEpoch) = epoch.time;
+//         clk.at(idEpoch)   = epoch.clockError;
+        observationTimes.push_back(epoch.time);
 
         // create observation class for each satellite
         UInt idObs  = 0;
-        for(UInt k=0; k<arc.at(arcEpoch).satellite.size(); k++)
+        for(UInt k=0; k<epoch.satellite.size(); k++)
         {
           Observation *obs = new Observation();
 
           // find list of observation types for this satellite
-          GnssType satType = arc.at(arcEpoch).satellite.at(k);
+          GnssType satType = epoch.satellite.at(k);
           UInt idType = 0;
-          while(arc.at(arcEpoch).obsType.at(idType) != satType)
+          while(epoch.obsType.at(idType) != satType)
             idType++;
 
-          for(; (idType<arc.at(arcEpoch).obsType.size()) && (arc.at(arcEpoch).obsType.at(idType)==satType); idType++, idObs++)
+          for(; (idType<epoch.obsType.size()) && (epoch.obsType.at(idType)==satType); idType++, idObs++)
           {
-            if(arc.at(arcEpoch).observation.at(idObs) != 0)
+            if(epoch.observation.at(idObs) != 0)
             {
-              GnssType type = arc.at(arcEpoch).obsType.at(idType) + satType;
+              GnssType type = epoch.obsType.at(idType) + satType;
               // remove GLONASS frequency number
               if((type == GnssType::GLONASS) && !((type == GnssType::G1) || (type == GnssType::G2)))
                 type.setFrequencyNumber(9999);
@@ -630,7 +631,7 @@ void Gnss::Receiver::readObservations(InstrumentFile &fileReceiver,
               if(GnssType::index(ignoreType, type) != NULLINDEX)
                 use = FALSE;
               if(use)
-                obs->push_back(SingleObservation(type, arc.at(arcEpoch).observation.at(idObs)));
+                obs->push_back(SingleObservation(type, epoch.observation.at(idObs)));
             }
           }
           if(obs->size() == 0)
@@ -659,7 +660,7 @@ void Gnss::Receiver::readObservations(InstrumentFile &fileReceiver,
           delete obs;
         } // for(satellite)
         idEpoch++;
-      } // for(arcEpoch)
+      }); // for(epoch)
       if(idEpoch >= times.size())
         break;
     } // for(arcNo)
@@ -12,6 +12,7 @@
 
 #include "base/importStd.h"
 #include "base/matrix.h"
+#include "base/matrixPacked.h"
 #include "base/vector3d.h"
 #include "base/tensor3d.h"
 #include "base/rotary3d.h"
@@ -35,6 +36,40 @@ UInt InArchive::versionStr2version(const std::string &str)
   return v;
 }
 
+/***********************************************/
+
+void OutArchive::save(const MatrixPacked &x)
+{
+  save(x.full());
+}
+
+/***********************************************/
+
+void InArchive::checkSymmetric(const Matrix &A)
+{
+  if(A.rows() != A.columns())
+    throw(Exception("GENERAL matrix ("+A.rows()%"%i x "s+A.columns()%"%i) cannot be read as symmetric packed matrix"s));
+  const Double threshold = 1e-12*maxabs(A);
+  for(UInt s=0; s<A.columns(); s++)
+    for(UInt z=s+1; z<A.rows(); z++)
+      if(std::fabs(A(z,s)-A(s,z)) > threshold)
+        throw(Exception("GENERAL matrix is not symmetric at ("+z%"%i, "s+s%"%i), cannot be read as symmetric packed matrix"s));
+}
+
+/***********************************************/
+
+void InArchive::load(MatrixPacked &x)
+{
+  Matrix A;
+  load(A);
+  if(A.getType() == Matrix::GENERAL) // interpreted as symmetric
+  {
+    checkSymmetric(A);
+    A.setType(Matrix::SYMMETRIC);
+  }
+  x = MatrixPacked(A);
+}
+
 /***********************************************/
 /***********************************************/
 
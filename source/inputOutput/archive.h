@@ -28,6 +28,7 @@ class Vector;
 class Matrix;
 class MatrixSlice;
 class const_MatrixSlice;
+class MatrixPacked;
 class SphericalHarmonics;
 class Doodson;
 class GnssType;
@@ -129,6 +130,7 @@ public:
   virtual void save(const Angle    &x) = 0;
   virtual void save(const Vector   &x) = 0;
   virtual void save(const const_MatrixSlice  &x) = 0;
+  virtual void save(const MatrixPacked       &x); // default: unpacked matrix
   virtual void save(const SphericalHarmonics &x) = 0;
   virtual void save(const Doodson  &x) = 0;
   virtual void save(const GnssType &x) = 0;
@@ -146,6 +148,8 @@ class InArchive
 {
 protected:
   static UInt versionStr2version(const std::string &str);
+  // GENERAL matrix is read as symmetric: throws if not quadratic or not symmetric
+  static void checkSymmetric(const Matrix &A);
 
 public:
   virtual ~InArchive() {}
@@ -172,6 +176,7 @@ public:
   virtual void load(Angle    &x) = 0;
   virtual void load(Vector   &x) = 0;
   virtual void load(Matrix   &x) = 0;
+  virtual void load(MatrixPacked &x); // default: packed from matrix
   virtual void load(SphericalHarmonics &x) = 0;
   virtual void load(Doodson  &x) = 0;
   virtual void load(GnssType &x) = 0;
@@ -192,6 +197,7 @@ template<> inline void save(OutArchive &ar, const Vector  &x)            {ar.sav
 template<> inline void save(OutArchive &ar, const Matrix  &x)            {ar.save(x);}
 template<> inline void save(OutArchive &ar, const MatrixSlice  &x)       {ar.save(x);}
 template<> inline void save(OutArchive &ar, const const_MatrixSlice  &x) {ar.save(x);}
+template<> inline void save(OutArchive &ar, const MatrixPacked &x)       {ar.save(x);}
 template<> inline void save(OutArchive &ar, const SphericalHarmonics &x) {ar.save(x);}
 template<> inline void save(OutArchive &ar, const Doodson &x)            {ar.save(x);}
 template<> inline void save(OutArchive &ar, const GnssType &x)           {ar.save(x);}
@@ -212,6 +218,7 @@ template<> inline void load(InArchive  &ar, Time    &x)                  {ar.loa
 template<> inline void load(InArchive  &ar, Angle   &x)                  {ar.load(x);}
 template<> inline void load(InArchive  &ar, Vector  &x)                  {ar.load(x);}
 template<> inline void load(InArchive  &ar, Matrix  &x)                  {ar.load(x);}
+template<> inline void load(InArchive  &ar, MatrixPacked &x)             {ar.load(x);}
 template<> inline void load(InArchive  &ar, SphericalHarmonics &x)       {ar.load(x);}
 template<> inline void load(InArchive  &ar, Doodson &x)                  {ar.load(x);}
 template<> inline void load(InArchive  &ar, GnssType &x)                 {ar.load(x);}
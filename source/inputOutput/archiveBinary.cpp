@@ -14,6 +14,7 @@
 #include "base/doodson.h"
 #include "base/sphericalHarmonics.h"
 #include "base/gnssType.h"
+#include "base/matrixPacked.h"
 #include "archive.h"
 #include "archiveBinary.h"
 
@@ -352,6 +353,65 @@ void InArchiveBinary::load(Matrix &x)
   }
 }
 
+/***********************************************/
+
+// same format as symmetric/triangular Matrix, one column of the triangle at once
+void OutArchiveBinary::save(const MatrixPacked &x)
+{
+  save(static_cast<UInt>(x.getType()));
+  UInt uplo = (x.isUpper()) ? 0 : 1; // compability to old version
+  save(uplo); save(x.rows());
+  if(x.rows() == 0)
+    return;
+  const Double *field = x.field();
+  std::vector<Double> column(x.rows());
+  for(UInt s=0; s<x.columns(); s++)
+  {
+    const UInt start = (x.isUpper()) ? 0   : s;
+    const UInt end   = (x.isUpper()) ? s+1 : x.rows();
+    for(UInt z=start; z<end; z++)
+      column[z-start] = field[x.index(z, s)];
+    stream.write(reinterpret_cast<const char*>(column.data()), (end-start)*sizeof(Double));
+  }
+}
+
+/***********************************************/
+
+// symmetric/triangular matrices are read directly into packed format without full temporary matrix
+void InArchiveBinary::load(MatrixPacked &x)
+{
+  UInt type;
+  load(type);
+  if(static_cast<Matrix::Type>(type)==Matrix::GENERAL) // interpreted as symmetric
+  {
+    UInt rows, columns;
+    load(rows); load(columns);
+    Matrix A(rows, columns);
+    if(A.size())
+      stream.read(reinterpret_cast<char*>(A.field()), A.size()*sizeof(Double));
+    checkSymmetric(A);
+    A.setType(Matrix::SYMMETRIC);
+    x = MatrixPacked(A);
+    return;
+  }
+
+  UInt dim, uplo;
+  load(uplo); load(dim);
+  x = MatrixPacked(dim, static_cast<Matrix::Type>(type), ((uplo==1) ? Matrix::LOWER : Matrix::UPPER));
+  if(dim == 0)
+    return;
+  Double *field = x.field();
+  std::vector<Double> column(dim);
+  for(UInt s=0; s<x.columns(); s++)
+  {
+    const UInt start = (x.isUpper()) ? 0   : s;
+    const UInt end   = (x.isUpper()) ? s+1 : x.rows();
+    stream.read(reinterpret_cast<char*>(column.data()), (end-start)*sizeof(Double));
+    for(UInt z=start; z<end; z++)
+      field[x.index(z, s)] = column[z-start];
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -43,6 +43,7 @@ protected:
   void save(const Angle       &x);
   void save(const Vector      &x);
   void save(const const_MatrixSlice  &x);
+  void save(const MatrixPacked       &x);
   void save(const SphericalHarmonics &x);
   void save(const Doodson     &x);
   void save(const GnssType    &x);
@@ -79,6 +80,7 @@ protected:
   void load(Angle    &x);
   void load(Vector   &x);
   void load(Matrix   &x);
+  void load(MatrixPacked &x);
   void load(SphericalHarmonics &x);
   void load(Doodson  &x);
   void load(GnssType &x);
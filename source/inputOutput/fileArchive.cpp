@@ -196,6 +196,15 @@ UInt InFileArchive::version() const
 
 /***********************************************/
 
+InArchive::ArchiveType InFileArchive::archiveType() const
+{
+  if(!archive)
+    throw(Exception("InFileArchive::archiveType: no file open"));
+  return archive->archiveType();
+}
+
+/***********************************************/
+
 Bool InFileArchive::canSeek() const
 {
   if(!archive || (archive->archiveType() != InArchive::BINARY))
@@ -22,7 +22,8 @@
 
 /***** CONSTANTS ********************************/
 
-const UInt FILE_VERSION = 20200123;    // date of last change (ArcList, InstrumentFile restructured)
+const UInt FILE_VERSION = 20261017;    // date of last change (GnssReceiver compact binary encoding)
+// const UInt FILE_VERSION = 20200123; // date of last change (ArcList, InstrumentFile restructured)
 // const UInt FILE_VERSION = 20190429; // date of last change (SatelliteModel Surface hasThermalReemission)
 // const UInt FILE_VERSION = 20190304; // date of last change (GnssStationInfo)
 // const UInt FILE_VERSION = 20170920; // date of last change
@@ -75,6 +76,7 @@ public:
   FileName    fileName() const {return file.fileName();}
   std::string type()     const;
   UInt        version()  const;
+  InArchive::ArchiveType archiveType() const;
 
   Bool           canSeek() const;
   std::streampos position();
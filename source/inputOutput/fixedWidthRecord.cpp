@@ -0,0 +1,311 @@
+/***********************************************/
+/**
+* @file fixedWidthRecord.cpp
+*
+* @brief Reading and writing of fixed-width text records (SP3, clock RINEX, RINEX navigation, ORBEX, ...).
+*
+* @date 2026-10-17
+*
+*/
+/***********************************************/
+
+#include "base/import.h"
+#include "inputOutput/fixedWidthRecord.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+
+/***********************************************/
+
+void FixedWidthRecord::field(UInt pos, UInt len, const Char *&begin, const Char *&end) const
+{
+  if(pos > length)
+    throw(Exception("field at position "s+pos%"%i exceeds line length "s+length%"%i: '"s+std::string(text, length)+"'"));
+  begin = text + pos;
+  end   = text + std::min(pos+len, length);
+}
+
+/***********************************************/
+
+Char FixedWidthRecord::at(UInt pos) const
+{
+  if(pos >= length)
+    throw(Exception("position "s+pos%"%i exceeds line length "s+length%"%i: '"s+std::string(text, length)+"'"));
+  return text[pos];
+}
+
+/***********************************************/
+
+Bool FixedWidthRecord::startsWith(const Char *str) const
+{
+  for(UInt i=0; str[i]; i++)
+    if((i >= length) || (text[i] != str[i]))
+      return FALSE;
+  return TRUE;
+}
+
+/***********************************************/
+
+Bool FixedWidthRecord::isEqual(UInt pos, UInt len, const Char *str) const
+{
+  try
+  {
+    const Char *begin, *end;
+    field(pos, len, begin, end);
+    for(; begin<end; begin++, str++)
+      if(!*str || (*begin != *str))
+        return FALSE;
+    return !*str;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Bool FixedWidthRecord::isBlank(UInt pos, UInt len) const
+{
+  try
+  {
+    const Char *begin, *end;
+    field(pos, len, begin, end);
+    return std::all_of(begin, end, ::isspace);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::string FixedWidthRecord::string(UInt pos, UInt len) const
+{
+  try
+  {
+    const Char *begin, *end;
+    field(pos, len, begin, end);
+    return std::string(begin, end);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Int FixedWidthRecord::toInt(UInt pos, UInt len) const
+{
+  try
+  {
+    const Char *begin, *end;
+    field(pos, len, begin, end);
+
+    // same rules as std::stoi
+    const Char *ptr = begin;
+    while((ptr<end) && std::isspace(*ptr))
+      ptr++;
+    if(ptr == end)
+      return 0;
+    const Bool negative = (*ptr == '-');
+    if((*ptr == '-') || (*ptr == '+'))
+      ptr++;
+    if((ptr == end) || !std::isdigit(*ptr))
+      throw(Exception("cannot read integer from string '"+std::string(begin, end)+"'"));
+    Int64 value = 0;
+    for(; (ptr<end) && std::isdigit(*ptr); ptr++)
+    {
+      value = 10*value + (*ptr-'0');
+      if(value > std::numeric_limits<Int>::max()+Int64(1))
+        throw(Exception("cannot read integer from string '"+std::string(begin, end)+"'"));
+    }
+    if(negative)
+      value = -value;
+    if(value > std::numeric_limits<Int>::max())
+      throw(Exception("cannot read integer from string '"+std::string(begin, end)+"'"));
+    return static_cast<Int>(value);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Double FixedWidthRecord::toDouble(UInt pos, UInt len) const
+{
+  try
+  {
+    const Char *begin, *end;
+    field(pos, len, begin, end);
+
+    const Char *ptr = begin;
+    while((ptr<end) && std::isspace(*ptr))
+      ptr++;
+    if(ptr == end)
+      return 0.;
+
+    // fast path: at most 19 significant digits and a power of ten that is exactly representable.
+    // Mantissa and power are exact, so the single rounding of the multiplication/division
+    // gives the correctly rounded result, the same as strtod.
+    {
+      const Char *p = ptr;
+      const Bool negative = (*p == '-');
+      if((*p == '-') || (*p == '+'))
+        p++;
+      UInt64 mantissa  = 0;
+      Int    digits    = 0; // significant digits
+      Int    exponent  = 0;
+      Bool   hasDigits = FALSE;
+      for(; (p<end) && std::isdigit(*p); p++, hasDigits=TRUE)
+        if(digits || (*p != '0'))
+        {
+          mantissa = 10*mantissa + (*p-'0');
+          digits++;
+        }
+      if((p<end) && (*p == '.'))
+        for(p++; (p<end) && std::isdigit(*p); p++, hasDigits=TRUE)
+        {
+          if(digits || (*p != '0'))
+          {
+            mantissa = 10*mantissa + (*p-'0');
+            digits++;
+          }
+          exponent--;
+        }
+      if((p<end) && ((*p == 'e') || (*p == 'E') || (*p == 'd') || (*p == 'D')))
+      {
+        const Char *q = p+1;
+        const Bool negativeExponent = (q<end) && (*q == '-');
+        if((q<end) && ((*q == '-') || (*q == '+')))
+          q++;
+        if((q<end) && std::isdigit(*q))
+        {
+          Int e = 0;
+          for(; (q<end) && std::isdigit(*q) && (e<10000); q++)
+            e = 10*e + (*q-'0');
+          exponent += negativeExponent ? -e : e;
+          p = q;
+        }
+      }
+      // trailing characters are ignored (as strtod), but hexadecimal, inf, nan, and digit exceeding numbers take the slow path
+      const Bool isSimple = hasDigits && (digits <= 19) && ((p == end) || !std::isalnum(*p));
+      if(isSimple && !mantissa)
+        return negative ? -0. : 0.;
+      if(isSimple && (mantissa <= (UInt64(1)<<53)) && (std::abs(exponent) <= 22))
+      {
+        static const Double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+        const Double value = (exponent < 0) ? (static_cast<Double>(mantissa)/powers[-exponent]) : (static_cast<Double>(mantissa)*powers[exponent]);
+        return negative ? -value : value;
+      }
+    }
+
+    // slow path: same as String::toDouble
+    std::string str(begin, end);
+    auto dpos = str.find_first_of("Dd");
+    if(dpos != std::string::npos)
+      str[dpos] = 'e';
+    Char *ptrEnd;
+    errno = 0;
+    const Double value = std::strtod(str.c_str(), &ptrEnd);
+    if((ptrEnd == str.c_str()) || (errno == ERANGE))
+      throw(Exception("cannot read double from string '"+std::string(begin, end)+"'"));
+    return value;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+/***********************************************/
+
+FixedWidthWriter &FixedWidthWriter::number(const Char *format, Double x, UInt width, UInt precision, Char fill)
+{
+  try
+  {
+    Char str[128];
+    const Int count = std::snprintf(str, sizeof(str), format, static_cast<int>(width), static_cast<int>(precision), x);
+    if((count < 0) || (count >= static_cast<Int>(sizeof(str))))
+      return text(static_cast<LongDouble>(x)%("%"s+(fill=='0' ? "0" : "")+width%"%i."s+precision%"%i"s+format[4]));
+    // stream semantic: fill characters are inserted before the sign
+    for(Int i=0; (i<count) && (str[i] == ' '); i++)
+      str[i] = fill;
+    buffer.append(str, count);
+    return *this;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+FixedWidthWriter &FixedWidthWriter::integer(Int x, UInt width, Char fill)
+{
+  try
+  {
+    Char str[32];
+    const Int count = std::snprintf(str, sizeof(str), "%*d", static_cast<int>(width), static_cast<int>(x));
+    for(Int i=0; (i<count) && (str[i] == ' '); i++)
+      str[i] = fill;
+    buffer.append(str, count);
+    return *this;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+FixedWidthWriter &FixedWidthWriter::date(const Time &time, UInt widthSecond, UInt precisionSecond)
+{
+  try
+  {
+    // same rounding as in operator%(LongDouble, const std::string &)
+    LongDouble value = time.mjdMod();
+    value += time.mjdInt();
+    const Int precision = static_cast<Int>(precisionSecond);
+    UInt   year, month, day, hour, minute;
+    Double second;
+    mjd2time(value).date(year, month, day, hour, minute, second);
+    second = std::round(second*std::pow(10., precision))/std::pow(10., precision) + std::pow(10., -(precision+1));
+    date2time(year, month, day, hour, minute, second).date(year, month, day, hour, minute, second);
+
+    Char str[64];
+    const Int count = std::snprintf(str, sizeof(str), "%04u %02u %02u %02u %02u ", static_cast<unsigned>(year), static_cast<unsigned>(month),
+                                    static_cast<unsigned>(day), static_cast<unsigned>(hour), static_cast<unsigned>(minute));
+    buffer.append(str, count);
+    return number("%*.*f", second, widthSecond, precisionSecond, '0');
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void FixedWidthWriter::write(std::ostream &stream)
+{
+  try
+  {
+    stream.write(buffer.data(), buffer.size());
+    buffer.clear();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
@@ -0,0 +1,149 @@
+/***********************************************/
+/**
+* @file fixedWidthRecord.h
+*
+* @brief Reading and writing of fixed-width text records (SP3, clock RINEX, RINEX navigation, ORBEX, ...).
+*
+* @date 2026-10-17
+*
+*/
+/***********************************************/
+
+#ifndef __GROOPS_FIXEDWIDTHRECORD__
+#define __GROOPS_FIXEDWIDTHRECORD__
+
+#include "base/import.h"
+#include <deque>
+#include <future>
+#include <thread>
+
+/** @addtogroup inputOutputGroup */
+/// @{
+
+/***** CLASS ***********************************/
+
+/** @brief View of a fixed-width text line.
+* The fields are parsed directly from the line without creating substrings.
+* The results are the same as with @a String::toInt / @a String::toDouble of @a line.substr(pos, len):
+* fields are clipped at the end of the line and all white spaces give zero.
+* The line must outlive the record.
+* @code
+* std::string line;
+* while(std::getline(file, line))
+* {
+*   FixedWidthRecord record(line);
+*   if(record.startsWith("P") && record.isEqual(1, 3, "G01"))
+*     x = record.toDouble(4, 14);
+* }
+* @endcode */
+class FixedWidthRecord
+{
+  const Char *text;
+  UInt        length;
+
+  void field(UInt pos, UInt len, const Char *&begin, const Char *&end) const;
+
+public:
+  explicit FixedWidthRecord(const std::string &line) : text(line.data()), length(line.size()) {}
+
+  /** @brief Number of characters in the line. */
+  UInt size() const {return length;}
+
+  /** @brief Character at @a pos. */
+  Char at(UInt pos) const;
+
+  /** @brief Does the line start with @a str? */
+  Bool startsWith(const Char *str) const;
+
+  /** @brief Is the field equal to @a str? (same as line.substr(pos, len) == str). */
+  Bool isEqual(UInt pos, UInt len, const Char *str) const;
+
+  /** @brief Does the field contain only white spaces? */
+  Bool isBlank(UInt pos, UInt len) const;
+
+  /** @brief Copy of the field (same as line.substr(pos, len)). */
+  std::string string(UInt pos, UInt len) const;
+
+  /** @brief Convert field to Int. Returns 0 if field is all white spaces. */
+  Int toInt(UInt pos, UInt len) const;
+
+  /** @brief Convert field to Double (Fortran exponent 'D' is accepted). Returns 0 if field is all white spaces. */
+  Double toDouble(UInt pos, UInt len) const;
+};
+
+/***** CLASS ***********************************/
+
+/** @brief Buffer for fixed-width text lines.
+* The fields give the same text as the corresponding format string (e.g. x%"%14.6f"s),
+* but without parsing the format and without stream objects for each number.
+* Lines are collected in a buffer and written as block.
+* @code
+* FixedWidthWriter writer;
+* writer.text("P").text(id).fixed(x, 14, 6).fixed(y, 14, 6).fixed(z, 14, 6).endLine();
+* writer.write(file);
+* @endcode */
+class FixedWidthWriter
+{
+  std::string buffer;
+
+  FixedWidthWriter &number(const Char *format, Double x, UInt width, UInt precision, Char fill);
+
+public:
+  FixedWidthWriter &text(const std::string &str) {buffer += str;  return *this;} //!< Append text.
+  FixedWidthWriter &text(const Char *str)        {buffer += str;  return *this;} //!< Append text.
+  FixedWidthWriter &text(Char c)                 {buffer += c;    return *this;} //!< Append character.
+  FixedWidthWriter &spaces(UInt count)           {buffer.append(count, ' '); return *this;} //!< Append @a count spaces.
+  FixedWidthWriter &endLine()                    {buffer += '\n'; return *this;} //!< Terminate line.
+
+  /** @brief Integer, same as x%"%<width>i"s (or "%0<width>i" with @a fill '0'). */
+  FixedWidthWriter &integer(Int x, UInt width, Char fill=' ');
+
+  /** @brief Decimal floating point, same as x%"%<width>.<precision>f"s. */
+  FixedWidthWriter &fixed(Double x, UInt width, UInt precision, Char fill=' ') {return number("%*.*f", x, width, precision, fill);}
+
+  /** @brief Scientific notation, same as x%"%<width>.<precision>e"s. */
+  FixedWidthWriter &scientific(Double x, UInt width, UInt precision, Char fill=' ') {return number("%*.*e", x, width, precision, fill);}
+
+  /** @brief Date and time, same as time%"%y %m %d %H %M %0<width>.<precision>S"s. */
+  FixedWidthWriter &date(const Time &time, UInt widthSecond, UInt precisionSecond);
+
+  /** @brief Buffered text. */
+  const std::string &str() const {return buffer;}
+
+  /** @brief Size of buffered text. */
+  UInt size() const {return buffer.size();}
+
+  /** @brief Write buffered text to @a stream and clear the buffer. */
+  void write(std::ostream &stream);
+};
+
+/***** FUNCTIONS *******************************/
+
+/** @brief Read files concurrently and process the results in order.
+* @a read(i) is called in worker threads (at most hardware concurrency files in advance).
+* @a process(i, result) is called in the calling thread in increasing order of i,
+* returning FALSE stops the processing of further files.
+* Exceptions of @a read are rethrown in the calling thread when the result is processed. */
+template<typename Read, typename Process>
+void readFilesConcurrently(UInt count, Read read, Process process)
+{
+  typedef decltype(read(UInt(0))) Result;
+  const UInt window = std::max(1u, std::thread::hardware_concurrency());
+  std::deque<std::future<Result>> tasks;
+  UInt next = 0;
+  for(UInt i=0; i<count; i++)
+  {
+    while((next<count) && (next<i+window))
+      tasks.push_back(std::async(std::launch::async, read, next++));
+    Result result = tasks.front().get();
+    tasks.pop_front();
+    if(!process(i, result))
+      break;
+  }
+}
+
+/// @}
+
+/***********************************************/
+
+#endif /* __GROOPS_FIXEDWIDTHRECORD__ */
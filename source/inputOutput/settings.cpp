@@ -52,6 +52,7 @@ void readFileSettings(const FileName &fileName)
     readXml(xmlNode, "DELTA_TT_GPS",  DELTA_TT_GPS);
     readXml(xmlNode, "J2000",         STRING_J2000);
     J2000 = atof(STRING_J2000.c_str());
+    readXml(xmlNode, "PREFETCH_MEMORY", PREFETCH_MEMORY);
 
     // read leap seconds
     UInt count = xmlNode->getChildCount("leapSecond");
@@ -98,6 +99,7 @@ void writeFileSettings(const FileName &fileName)
     writeXml(xmlNode, "DELTA_TAI_GPS",  DELTA_TAI_GPS);
     writeXml(xmlNode, "DELTA_TT_GPS",   DELTA_TT_GPS);
     writeXml(xmlNode, "J2000",          STRING_J2000);
+    writeXml(xmlNode, "PREFETCH_MEMORY", PREFETCH_MEMORY);
 
     for(UInt i=0; i<DELTA_UTC_GPS.size(); i++)
     {
@@ -186,6 +186,22 @@ ObservationMiscPod::Arc ObservationMiscPodIntegral::computeArc(UInt arcNo, Covar
     for(UInt j=0; j<rhsCount; j++)
       pod.at(j) = rhs.at(j)->orbitFile->readArc(arcNo);
 
+    // read accelerometer
+    // ------------------
+    std::vector<AccelerometerArc> accelerometerRhs(rhsCount);
+    for(UInt j=0; j<rhsCount; j++)
+      accelerometerRhs.at(j) = rhs.at(j)->accelerometerFile->readArc(arcNo);
+
+    // read next arc in background
+    // ---------------------------
+    if(arcNo+1 < countArc)
+    {
+      std::vector<std::reference_wrapper<InstrumentFile>> fileList{orbitFile, starCameraFile};
+      for(UInt j=0; j<rhsCount; j++)
+        fileList.insert(fileList.end(), {*rhs.at(j)->orbitFile, *rhs.at(j)->accelerometerFile});
+      InstrumentFile::prefetchArc(fileList, arcNo+1);
+    }
+
     for(UInt j=1; j<rhsCount; j++)
       for(UInt i=0; i<pod.at(j).size(); i++)
         if(pod.at(j).at(i).time != pod.at(j-1).at(i).time)
@@ -207,7 +223,7 @@ ObservationMiscPod::Arc ObservationMiscPodIntegral::computeArc(UInt arcNo, Covar
     AccelerometerArc accelerometer;
     for(UInt j=0; j<rhsCount; j++)
     {
-      AccelerometerArc accl = rhs.at(j)->accelerometerFile->readArc(arcNo);
+      const AccelerometerArc &accl = accelerometerRhs.at(j);
       if((accelerometer.size() == 0) && (accl.size() != 0))
         accelerometer = accl;
 
@@ -290,9 +306,11 @@ ObservationMiscPod::Arc ObservationMiscPodIntegral::computeArc(UInt arcNo, Covar
     // gravity field
     if(parameterGravity->parameterCount())
     {
-      Matrix G(3*epochCount, parameterGravity->parameterCount());
+      std::vector<Vector3d> points(epochCount);
       for(UInt k=0; k<epochCount; k++)
-        parameterGravity->gravity(orbit.at(k).time, rotEarth.at(k).rotate(orbit.at(k).position), G.row(3*k, 3));
+        points.at(k) = rotEarth.at(k).rotate(orbit.at(k).position);
+      Matrix G(3*epochCount, parameterGravity->parameterCount());
+      parameterGravity->gravity(orbit.times(), points, G);
       matMult(1., VPos, G, A.column(idxGravity, G.columns()));
     }
     // Accelerometer calibration
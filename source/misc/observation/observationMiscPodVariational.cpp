@@ -118,6 +118,8 @@ ObservationMiscPod::Arc ObservationMiscPodVariational::computeArc(UInt arcNo, Co
     // read POD observations
     // ---------------------
     OrbitArc pod = podFile.readArc(arcNo);
+    if(arcNo+1 < countArc)
+      InstrumentFile::prefetchArc({podFile}, arcNo+1); // read next arc in background
 
     const UInt obsCount = 3*pod.size();
     if(obsCount == 0)
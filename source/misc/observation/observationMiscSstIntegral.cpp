@@ -295,6 +295,30 @@ ObservationMiscSst::Arc ObservationMiscSstIntegral::computeArc(UInt arcNo, Covar
       ::Arc::checkSynchronized({pod2.at(j), pod2.at(0)});
     }
 
+    // read accelerometer
+    // ------------------
+    std::vector<AccelerometerArc> accelerometer1(rhsCount);
+    std::vector<AccelerometerArc> accelerometer2(rhsCount);
+    for(UInt j=0; j<rhsCount; j++)
+    {
+      accelerometer1.at(j) = rhs.at(j)->accelerometer1File->readArc(arcNo);
+      accelerometer2.at(j) = rhs.at(j)->accelerometer2File->readArc(arcNo);
+    }
+
+    // read next arc in background
+    // ---------------------------
+    if(arcNo+1 < countArc)
+    {
+      std::vector<std::reference_wrapper<InstrumentFile>> fileList{orbit1File, orbit2File, starCamera1File, starCamera2File};
+      for(UInt j=0; j<rhsCount; j++)
+      {
+        for(UInt k=0; k<rhs.at(j)->sstFile.size(); k++)
+          fileList.push_back(*rhs.at(j)->sstFile.at(k));
+        fileList.insert(fileList.end(), {*rhs.at(j)->orbit1File, *rhs.at(j)->orbit2File, *rhs.at(j)->accelerometer1File, *rhs.at(j)->accelerometer2File});
+      }
+      InstrumentFile::prefetchArc(fileList, arcNo+1);
+    }
+
     // =============================================
 
     // count observations
@@ -328,7 +352,7 @@ ObservationMiscSst::Arc ObservationMiscSstIntegral::computeArc(UInt arcNo, Covar
     Matrix g1(3*epochCount, rhsCount);
     for(UInt j=0; j<rhsCount; j++)
     {
-      AccelerometerArc accelerometer = rhs.at(j)->accelerometer1File->readArc(arcNo);
+      const AccelerometerArc &accelerometer = accelerometer1.at(j);
       for(UInt k=0; k<epochCount; k++)
       {
         Vector3d gv = rhs.at(j)->forces->acceleration(satellite1, orbit1.at(k).time, orbit1.at(k).position, orbit1.at(k).velocity,
@@ -347,7 +371,7 @@ ObservationMiscSst::Arc ObservationMiscSstIntegral::computeArc(UInt arcNo, Covar
     Matrix g2(3*epochCount, rhsCount);
     for(UInt j=0; j<rhsCount; j++)
     {
-      AccelerometerArc accelerometer = rhs.at(j)->accelerometer2File->readArc(arcNo);
+      const AccelerometerArc &accelerometer = accelerometer2.at(j);
       for(UInt k=0; k<epochCount; k++)
       {
         Vector3d gv = rhs.at(j)->forces->acceleration(satellite2, orbit2.at(k).time, orbit2.at(k).position, orbit2.at(k).velocity,
@@ -628,13 +652,16 @@ ObservationMiscSst::Arc ObservationMiscSstIntegral::computeArc(UInt arcNo, Covar
     // -------------------------
     if(gravityCount)
     {
+      std::vector<Vector3d> points(epochCount);
       Matrix G(3*epochCount, gravityCount);
       for(UInt k=0; k<epochCount; k++)
-        parameterGravity->gravity(orbit1.at(k).time, rotEarth.at(k).rotate(orbit1.at(k).position), G.row(3*k,3));
+        points.at(k) = rotEarth.at(k).rotate(orbit1.at(k).position);
+      parameterGravity->gravity(orbit1.times(), points, G);
       matMult(1., V.column(0,3*epochCount), G, A.column(idxGravity, gravityCount));
 
       for(UInt k=0; k<epochCount; k++)
-        parameterGravity->gravity(orbit2.at(k).time, rotEarth.at(k).rotate(orbit2.at(k).position), G.row(3*k,3));
+        points.at(k) = rotEarth.at(k).rotate(orbit2.at(k).position);
+      parameterGravity->gravity(orbit2.times(), points, G);
       matMult(1., V.column(3*epochCount,3*epochCount), G, A.column(idxGravity, gravityCount));
     }
 
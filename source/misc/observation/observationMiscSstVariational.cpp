@@ -200,6 +200,16 @@ ObservationMiscSstVariational::Arc ObservationMiscSstVariational::computeArc(UIn
     OrbitArc pod1 = pod1File.readArc(arcNo);
     OrbitArc pod2 = pod2File.readArc(arcNo);
 
+    // read next arc in background
+    // ---------------------------
+    if(arcNo+1 < countArc)
+    {
+      std::vector<std::reference_wrapper<InstrumentFile>> fileList{pod1File, pod2File};
+      for(UInt k=0; k<sstFile.size(); k++)
+        fileList.push_back(*sstFile.at(k));
+      InstrumentFile::prefetchArc(fileList, arcNo+1);
+    }
+
     // =============================================
 
     const UInt epochCount = sst.at(0).size();
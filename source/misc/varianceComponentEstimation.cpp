@@ -40,6 +40,44 @@ Matrix Vce::monteCarlo(UInt rows, UInt columns)
 
 /***********************************************/
 
+Double Vce::traceMonteCarlo(const_MatrixSliceRef A, const_MatrixSliceRef Wz, Double accuracy, UInt blockSize)
+{
+  try
+  {
+    const UInt count = Wz.columns();
+    if((accuracy <= 0) || (count <= 2*blockSize))
+      return quadsum(A*Wz);
+
+    Double sum = 0, sum2 = 0;
+    UInt   used = 0;
+    for(UInt s=0; s<count; s+=blockSize)
+    {
+      const Matrix AWz = A * Wz.column(s, std::min(blockSize, count-s));
+      for(UInt k=0; k<AWz.columns(); k++)
+      {
+        const Double t = quadsum(AWz.column(k));
+        sum  += t;
+        sum2 += t*t;
+      }
+      used += AWz.columns();
+      if((used < count) && (used >= 2*blockSize))
+      {
+        const Double mean     = sum/used;
+        const Double variance = std::max(sum2-used*mean*mean, 0.)/(used-1);
+        if(std::sqrt(variance/used) <= accuracy*mean)
+          break;
+      }
+    }
+    return count*sum/used;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 Double Vce::standardDeviation(Double ePe, Double redundancy, Double huber, Double huberPower)
 {
   constexpr Double dx = 1e-4;
@@ -26,6 +26,12 @@ namespace Vce
   * The number of @p columns increases the reliability. */
   Matrix monteCarlo(UInt rows, UInt columns);
 
+  /** @brief Monte Carlo estimation of trace(A*N^-1*A^T) = quadsum(A*Wz).
+  * The columns of @p Wz (see @a monteCarlo) are used in blocks of @p blockSize. Each column gives an independent
+  * estimation. No more columns are used if the standard deviation of the mean
+  * is below @p accuracy relative to the estimated trace (0: all columns are used). */
+  Double traceMonteCarlo(const_MatrixSliceRef A, const_MatrixSliceRef Wz, Double accuracy=0, UInt blockSize=20);
+
   /** @brief Estimates the standardDeviation in case of otuliers.
   * The quadratic sum of residuals @p ePe and the @p redundancy are computed with downweigthed data. */
   Double standardDeviation(Double ePe, Double redundancy, Double huber, Double huberPower);
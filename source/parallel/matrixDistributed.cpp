@@ -12,9 +12,59 @@
 /***********************************************/
 
 #include "base/import.h"
+#include "external/lapack/blas.h"
+#include "external/lapack/lapack.h"
 #include "parallel/parallel.h"
 #include "matrixDistributed.h"
 
+/***********************************************/
+/***** single precision block operations *******/
+/***********************************************/
+
+// column major single precision copy of A (upper triangle only for symmetric matrices)
+static std::vector<Float> matrix2Float(const_MatrixSliceRef A)
+{
+  std::vector<Float> a(A.rows()*A.columns(), 0.f);
+  if(A.getType() == Matrix::SYMMETRIC)
+  {
+    for(UInt s=0; s<A.columns(); s++)
+      for(UInt z=0; z<=s; z++)
+        a[z+s*A.rows()] = static_cast<Float>(A.isUpper() ? A(z,s) : A(s,z));
+    return a;
+  }
+  for(UInt s=0; s<A.columns(); s++)
+    for(UInt z=0; z<A.rows(); z++)
+      a[z+s*A.rows()] = static_cast<Float>(A(z,s));
+  return a;
+}
+
+// A = a (upper triangle only for triangular matrices)
+static void float2Matrix(const std::vector<Float> &a, MatrixSliceRef A)
+{
+  for(UInt s=0; s<A.columns(); s++)
+    for(UInt z=0; z<((A.getType() == Matrix::TRIANGULAR) ? s+1 : A.rows()); z++)
+      A(z,s) = a[z+s*A.rows()];
+}
+
+// x += c * W * y (or W' * y), W (rows x columns) in single precision
+static void matMultFloat(Double c, Bool trans, const std::vector<Float> &W, UInt rows, const_MatrixSliceRef y, MatrixSliceRef x)
+{
+  const std::vector<Float> a = matrix2Float(y);
+  std::vector<Float>       b = matrix2Float(x);
+  blas_sgemm(trans, FALSE, static_cast<F77Int>(x.rows()), static_cast<F77Int>(x.columns()), static_cast<F77Int>(y.rows()), static_cast<Float>(c),
+             W.data(), static_cast<F77Int>(rows), a.data(), static_cast<F77Int>(y.rows()), 1.0f, b.data(), static_cast<F77Int>(x.rows()));
+  float2Matrix(b, x);
+}
+
+// x = W^-1 x (or W^-T x), W upper triangular in single precision
+static void triangularSolveFloat(Bool trans, const std::vector<Float> &W, MatrixSliceRef x)
+{
+  std::vector<Float> b = matrix2Float(x);
+  blas_strsm(TRUE, TRUE, trans, FALSE, static_cast<F77Int>(x.rows()), static_cast<F77Int>(x.columns()), 1.0f,
+             W.data(), static_cast<F77Int>(x.rows()), b.data(), static_cast<F77Int>(x.rows()));
+  float2Matrix(b, x);
+}
+
 /***********************************************/
 
 MatrixDistributed::MatrixDistributed() : _blockIndex{0}
@@ -204,6 +254,52 @@ void MatrixDistributed::reduceSum(Matrix &x, UInt idx, const std::vector<Bool> &
   }
 }
 
+/***********************************************/
+
+void MatrixDistributed::broadCast(std::vector<Float> &x, UInt size, UInt idx, const std::vector<Bool> &usedRank)
+{
+  try
+  {
+    std::vector<UInt> ranks = {_rank[idx]};
+    for(UInt idProcess=0; idProcess<usedRank.size(); idProcess++)
+      if(usedRank.at(idProcess) && (idProcess != _rank[idx]))
+        ranks.push_back(idProcess);
+    Parallel::CommunicatorPtr commNew = Parallel::createCommunicator(ranks, comm);
+    if(!commNew)
+      return;
+    x.resize(size);
+    Parallel::broadCast(reinterpret_cast<Byte*>(x.data()), size*sizeof(Float), 0, commNew);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void MatrixDistributed::reduceSum(std::vector<Float> &x, UInt size, UInt idx, const std::vector<Bool> &usedRank)
+{
+  try
+  {
+    std::vector<UInt> ranks = {_rank[idx]};
+    for(UInt idProcess=0; idProcess<usedRank.size(); idProcess++)
+      if(usedRank.at(idProcess) && (idProcess != _rank[idx]))
+        ranks.push_back(idProcess);
+    Parallel::CommunicatorPtr commNew = Parallel::createCommunicator(ranks, comm);
+    if(!commNew)
+      return;
+    x.resize(size, 0.f);
+    Parallel::reduceSum(x, 0, commNew);
+    if(!isMyRank(idx))
+      std::vector<Float>().swap(x);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
@@ -569,6 +665,317 @@ Matrix MatrixDistributed::solve(const_MatrixSliceRef n, Bool timing)
 
 /***********************************************/
 
+Bool MatrixDistributed::choleskySingle(std::vector<std::vector<Float>> &W, Bool timing)
+{
+  try
+  {
+    W.clear();
+    W.resize(_N.size());
+
+    // at first use the blocks are converted from N (own rank) or initialized with zero (partial sums of other ranks)
+    auto block = [&](UInt i, UInt k, UInt ik) -> std::vector<Float>&
+    {
+      if(W[ik].empty())
+        W[ik] = (isMyRank(ik) && _N[ik].size()) ? matrix2Float(_N[ik]) : std::vector<Float>(blockSize(i)*blockSize(k), 0.f);
+      return W[ik];
+    };
+
+    Bool failed = FALSE;
+    if(timing) logTimerStart;
+    for(UInt i=0; i<blockCount(); i++)
+      if(blockSize(i))
+      {
+        if(timing) logTimerLoop(i, blockCount());
+        const UInt ii = index(i,i);
+        if(ii == NULLINDEX)
+          throw(Exception("Diagonal block ("+i%"%i, "s+i%"%i) is not set."s));
+
+        loopBlockColumn({0, i}, i, [&](UInt z, UInt zi)
+        {
+          // column rank k update
+          if(isMyRank(zi))
+            blas_ssyrk(TRUE, TRUE, static_cast<F77Int>(blockSize(i)), static_cast<F77Int>(blockSize(z)), -1.0f,
+                       W[zi].data(), static_cast<F77Int>(blockSize(z)), 1.0f, block(i, i, ii).data(), static_cast<F77Int>(blockSize(i)));
+
+          // distribute top column to right hand side blocks
+          if(Parallel::size(comm) > 1)
+            broadCast(W[zi], blockSize(z)*blockSize(i), zi, usedRanksInRow(z, {i+1, blockCount()}));
+
+          // sgemm
+          loopBlockRow(z, {i+1, blockCount()}, [&](UInt s, UInt zs)
+          {
+            UInt is = index(i, s);
+            if(is == NULLINDEX) // fill-in: structure only, the factor is stored in W
+            {
+              is = setBlock(i, s);
+              _N[is] = Matrix();
+              W.resize(_N.size());
+            }
+            if(isMyRank(zs))
+              blas_sgemm(TRUE, FALSE, static_cast<F77Int>(blockSize(i)), static_cast<F77Int>(blockSize(s)), static_cast<F77Int>(blockSize(z)), -1.0f,
+                         W[zi].data(), static_cast<F77Int>(blockSize(z)), W[zs].data(), static_cast<F77Int>(blockSize(z)),
+                         1.0f, block(i, s, is).data(), static_cast<F77Int>(blockSize(i)));
+          });
+
+          // free column
+          if(!isMyRank(zi))
+            std::vector<Float>().swap(W[zi]);
+        }); // for(row z)
+
+        // collect right row elements from top block
+        if((i>0) && (Parallel::size(comm) > 1))
+          loopBlockRow(i, {i, blockCount()}, [&](UInt s, UInt is)
+          {
+            std::vector<Bool> usedRank(Parallel::size(comm), FALSE);
+            loopBlockColumn({0, i}, i, [&](UInt z, UInt /*zi*/)
+            {
+              const UInt zs = index(z,s);
+              if(zs != NULLINDEX)
+                usedRank.at(_rank[zs]) = TRUE;
+            });
+            if(isMyRank(is))
+              block(i, s, is);
+            reduceSum(W[is], blockSize(i)*blockSize(s), is, usedRank);
+          });
+
+        // cholesky
+        if(isMyRank(ii))
+          failed = (lapack_spotrf(TRUE, blockSize(i), block(i, i, ii).data(), blockSize(i)) != 0);
+        if(Parallel::size(comm) > 1)
+          Parallel::broadCast(failed, _rank[ii], comm);
+        if(failed) // not positive definite in single precision
+        {
+          W.clear();
+          return FALSE;
+        }
+
+        // distribute diagonal element to row
+        if(Parallel::size(comm) > 1)
+          broadCast(W[ii], blockSize(i)*blockSize(i), ii, usedRanksInRow(i, {i+1, blockCount()}));
+
+        // triangularSolve to row
+        loopBlockRow(i, {i+1, blockCount()}, [&](UInt s, UInt is)
+        {
+          if(isMyRank(is))
+            blas_strsm(TRUE, TRUE, TRUE, FALSE, static_cast<F77Int>(blockSize(i)), static_cast<F77Int>(blockSize(s)), 1.0f,
+                       W[ii].data(), static_cast<F77Int>(blockSize(i)), block(i, s, is).data(), static_cast<F77Int>(blockSize(i)));
+        });
+
+        // free diagonal
+        if(!isMyRank(ii))
+          std::vector<Float>().swap(W[ii]);
+      }
+    Parallel::barrier(comm);
+    if(timing) logTimerLoopEnd(blockCount());
+    return TRUE;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void MatrixDistributed::triangularTransSolveSingle(const std::vector<std::vector<Float>> &W, std::vector<Matrix> &x)
+{
+  try
+  {
+    for(UInt i=0; i<blockCount(); i++)
+      if(blockSize(i))
+      {
+        const UInt ii = index(i,i);
+
+        // collect
+        if(Parallel::size(comm) > 1)
+        {
+          std::vector<Bool> usedRank = usedRanksInColumn({0, i}, i);
+          usedRank.at(0) = TRUE; // master
+          reduceSum(x.at(i), ii, usedRank);
+        }
+
+        // solve
+        if(isMyRank(ii))
+          triangularSolveFloat(TRUE, W[ii], x.at(i));
+
+        // distribute to row
+        if(Parallel::size(comm) > 1)
+        {
+          std::vector<Bool> usedRank = usedRanksInRow(i, {i, blockCount()});
+          usedRank.at(0) = TRUE; // master
+          broadCast(x.at(i), ii, usedRank);
+        }
+
+        // reduce
+        loopBlockRow(i, {i+1, blockCount()}, [&](UInt s, UInt is)
+        {
+          if(isMyRank(is) && W[is].size())
+            matMultFloat(-1., TRUE, W[is], blockSize(i), x.at(i), x.at(s));
+        });
+
+        // free
+        if(!Parallel::isMaster(comm))
+          x.at(i).setNull();
+      }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void MatrixDistributed::triangularSolveSingle(const std::vector<std::vector<Float>> &W, std::vector<Matrix> &x)
+{
+  try
+  {
+    for(UInt i=blockCount(); i-->0;)
+      if(blockSize(i))
+      {
+        const UInt ii = index(i,i);
+
+        // collect
+        if(Parallel::size(comm) > 1)
+        {
+          std::vector<Bool> usedRank = usedRanksInRow(i, {i, blockCount()});
+          usedRank.at(0) = TRUE; // master
+          reduceSum(x.at(i), ii, usedRank);
+        }
+
+        // solve
+        if(isMyRank(ii))
+          triangularSolveFloat(FALSE, W[ii], x.at(i));
+
+        // distribute to top column
+        if(Parallel::size(comm) > 1)
+        {
+          std::vector<Bool> usedRank = usedRanksInColumn({0, i}, i);
+          usedRank.at(0) = TRUE; // master
+          broadCast(x.at(i), ii, usedRank);
+        }
+
+        // reduce
+        loopBlockColumn({0, i}, i, [&](UInt z, UInt zi)
+        {
+          if(isMyRank(zi) && W[zi].size())
+            matMultFloat(-1., FALSE, W[zi], blockSize(z), x.at(i), x.at(z));
+        });
+
+        // free
+        if(!Parallel::isMaster(comm))
+          x.at(i).setNull();
+      }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix MatrixDistributed::solveMixedPrecision(const_MatrixSliceRef n, Double tolerance, UInt maxIter, Bool timing)
+{
+  try
+  {
+    UInt rhsCount = n.columns();
+    Parallel::broadCast(rhsCount, 0, comm);
+
+    // the blocks of N are not changed, the factor is stored in single precision
+    if(timing && Parallel::isMaster(comm)) logStatus<<"cholesky decomposition (single precision)"<<Log::endl;
+    std::vector<std::vector<Float>> W;
+    if(!choleskySingle(W, timing))
+    {
+      if(Parallel::isMaster(comm))
+        logWarning<<"matrix is not positive definite in single precision -> cholesky decomposition in double precision"<<Log::endl;
+      return solve(n, timing);
+    }
+
+    // x = N^-1 r with single precision factor (valid at master)
+    auto solveSingle = [&](const_MatrixSliceRef r)
+    {
+      std::vector<Matrix> x(blockCount());
+      for(UInt i=0; i<blockCount(); i++)
+        x.at(i) = Parallel::isMaster(comm) ? Matrix(r.row(blockIndex(i), blockSize(i))) : Matrix(blockSize(i), rhsCount);
+      triangularTransSolveSingle(W, x);
+      triangularSolveSingle(W, x);
+      Matrix x2(dimension(), rhsCount);
+      if(Parallel::isMaster(comm))
+        for(UInt i=0; i<blockCount(); i++)
+          copy(x.at(i), x2.row(blockIndex(i), blockSize(i)));
+      return x2;
+    };
+
+    // r = n - N*x (valid at master)
+    auto residuals = [&](const Matrix &x)
+    {
+      Matrix r(x.rows(), x.columns());
+      for(UInt i=0; i<blockCount(); i++)
+        for(const auto &k : _column.at(i))
+          if(isMyRank(k.second) && _N.at(k.second).size())
+          {
+            const Matrix &N = _N.at(k.second);
+            matMult(-1., N, x.row(blockIndex(k.first), blockSize(k.first)), r.row(blockIndex(i), blockSize(i)));
+            if(i != k.first) // lower triangle
+              matMult(-1., N.trans(), x.row(blockIndex(i), blockSize(i)), r.row(blockIndex(k.first), blockSize(k.first)));
+          }
+      Parallel::reduceSum(r, 0, comm);
+      if(Parallel::isMaster(comm))
+        r += n;
+      return r;
+    };
+
+    Matrix x = solveSingle(n);
+    Parallel::broadCast(x, 0, comm);
+
+    Bool converged = FALSE;
+    for(UInt iter=0; (iter<maxIter) && !converged; iter++)
+    {
+      const Matrix dx = solveSingle(residuals(x));
+      if(Parallel::isMaster(comm))
+      {
+        x += dx;
+        Double maxChange = 0;
+        for(UInt s=0; s<x.columns(); s++)
+          maxChange = std::max(maxChange, norm(dx.column(s))/std::max(norm(x.column(s)), 1e-300));
+        converged = (maxChange <= tolerance);
+        if(timing) logInfo<<"  iterative refinement "<<iter+1<<": max. relative change = "<<maxChange%"%.2e"s<<Log::endl;
+      }
+      Parallel::broadCast(x, 0, comm);
+      Parallel::broadCast(converged, 0, comm);
+    }
+
+    if(!converged)
+    {
+      if(Parallel::isMaster(comm))
+        logWarning<<"iterative refinement not converged -> cholesky decomposition in double precision"<<Log::endl;
+      W.clear();
+      return solve(n, timing);
+    }
+
+    // replace N by the cholesky factor
+    for(UInt i=0; i<blockCount(); i++)
+      loopBlockRow(i, {i, blockCount()}, [&](UInt k, UInt ik)
+      {
+        if(!isMyRank(ik))
+          return;
+        _N[ik] = (i == k) ? Matrix(blockSize(i), Matrix::TRIANGULAR, Matrix::UPPER) : Matrix(blockSize(i), blockSize(k));
+        if(W[ik].size())
+          float2Matrix(W[ik], _N[ik]);
+        std::vector<Float>().swap(W[ik]);
+      });
+
+    return x;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void MatrixDistributed::triangularSolve(MatrixSliceRef x2)
 {
   try
@@ -1151,6 +1558,177 @@ void MatrixDistributed::reorder(const std::vector<UInt> &index, const std::vecto
 
 /***********************************************/
 
+std::vector<UInt> MatrixDistributed::reorderBlocks(const std::vector<UInt> &order)
+{
+  try
+  {
+    if(order.size() != blockCount())
+      throw(Exception("order and blockCount do not match."));
+
+    std::vector<UInt> index;
+    std::vector<UInt> blockIndexNew(1, 0);
+    index.reserve(parameterCount());
+    for(UInt i : order)
+    {
+      for(UInt k=0; k<blockSize(i); k++)
+        index.push_back(blockIndex(i)+k);
+      blockIndexNew.push_back(index.size());
+    }
+
+    reorder(index, blockIndexNew, calcRank);
+    return index;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+std::vector<UInt> MatrixDistributed::minimumDegreeBlockOrder() const
+{
+  try
+  {
+    // block graph (without diagonal)
+    std::vector<std::set<UInt>> neighbors(blockCount());
+    for(UInt i=0; i<blockCount(); i++)
+      loopBlockRow(i, {i+1, blockCount()}, [&](UInt k, UInt /*ik*/)
+      {
+        neighbors.at(i).insert(k);
+        neighbors.at(k).insert(i);
+      });
+
+    auto degree = [&](UInt i)
+    {
+      Double d = 0;
+      for(UInt k : neighbors.at(i))
+        d += blockSize(k);
+      return d * blockSize(i);
+    };
+
+    // eliminate node with minimum degree
+    // the neighbors of an eliminated node build a clique (fill-in)
+    std::vector<UInt> order;
+    std::set<std::pair<Double, UInt>> queue;
+    std::vector<Double> degrees(blockCount());
+    for(UInt i=0; i<blockCount(); i++)
+      queue.insert({degrees.at(i) = degree(i), i});
+    while(queue.size())
+    {
+      const UInt i = queue.begin()->second;
+      queue.erase(queue.begin());
+      order.push_back(i);
+
+      std::set<UInt> clique;
+      std::swap(clique, neighbors.at(i));
+      for(UInt k : clique)
+      {
+        neighbors.at(k).erase(i);
+        neighbors.at(k).insert(clique.begin(), clique.end());
+        neighbors.at(k).erase(k);
+      }
+      for(UInt k : clique)
+      {
+        queue.erase({degrees.at(k), k});
+        queue.insert({degrees.at(k) = degree(k), k});
+      }
+    }
+
+    return order;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+UInt MatrixDistributed::symbolicCholesky(const std::vector<UInt> &order, Bool dense, Double &elements, Double &flops) const
+{
+  try
+  {
+    std::vector<UInt> position(blockCount()); // new position of old block
+    std::iota(position.begin(), position.end(), 0);
+    if(order.size())
+    {
+      if(order.size() != blockCount())
+        throw(Exception("order and blockCount do not match."));
+      for(UInt i=0; i<order.size(); i++)
+        position.at(order.at(i)) = i;
+    }
+
+    std::vector<Double> size(blockCount());
+    for(UInt i=0; i<blockCount(); i++)
+      size.at(position.at(i)) = static_cast<Double>(blockSize(i));
+
+    // all blocks used -> dense
+    UInt usedBlocks = 0;
+    for(UInt i=0; i<blockCount(); i++)
+      loopBlockRow(i, {i, blockCount()}, [&](UInt /*k*/, UInt /*ik*/) {usedBlocks++;});
+    if(usedBlocks == blockCount()*(blockCount()+1)/2)
+      dense = TRUE;
+
+    // dense: closed form with sums over the following blocks
+    // sum_k n_k (= sumSize) and sum_k n_k^2 (= sumSize2)
+    if(dense)
+    {
+      UInt blocks = 0;
+      Double sumSize = 0, sumSize2 = 0;
+      elements = flops = 0;
+      for(UInt i=blockCount(); i-->0;)
+      {
+        const Double n = size.at(i);
+        blocks   += blockCount()-i;
+        elements += n*n + n*sumSize;
+        flops    += n*n*n/3 + n*n*sumSize + n*sumSize2 + n*(sumSize*sumSize-sumSize2);
+        sumSize  += n;
+        sumSize2 += n*n;
+      }
+      return blocks;
+    }
+
+    // upper block triangle in new order
+    std::vector<std::set<UInt>> upper(blockCount());
+    for(UInt i=0; i<blockCount(); i++)
+      loopBlockRow(i, {i+1, blockCount()}, [&](UInt k, UInt /*ik*/)
+      {
+        upper.at(std::min(position.at(i), position.at(k))).insert(std::max(position.at(i), position.at(k)));
+      });
+
+    // right looking block elimination
+    UInt blocks = 0;
+    elements = flops = 0;
+    for(UInt i=0; i<blockCount(); i++)
+    {
+      const Double n = size.at(i);
+      blocks   += 1 + upper.at(i).size();
+      elements += n*n;
+      flops    += n*n*n/3;                       // cholesky of diagonal block
+      for(auto k=upper.at(i).begin(); k!=upper.at(i).end(); k++)
+      {
+        elements += n*size.at(*k);
+        flops    += n*n*size.at(*k);             // triangular solve
+        flops    += n*size.at(*k)*size.at(*k);   // rank k update of diagonal block
+        for(auto s=std::next(k); s!=upper.at(i).end(); s++)
+        {
+          flops += 2*n*size.at(*k)*size.at(*s); // update of off-diagonal block
+          upper.at(*k).insert(*s);             // fill-in
+        }
+      }
+    }
+
+    return blocks;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 std::vector<UInt> MatrixDistributed::computeBlockIndex(UInt parameterCount, UInt blockSize)
 {
   if(parameterCount==0)
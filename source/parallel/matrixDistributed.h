@@ -48,6 +48,8 @@ class MatrixDistributed
   std::vector<Bool> usedRanksInRow(UInt row, const std::array<UInt,2> &cols) const;
   void broadCast(Matrix &x, UInt idx, const std::vector<Bool> &usedRank);
   void reduceSum(Matrix &x, UInt idx, const std::vector<Bool> &usedRank, Bool free=TRUE);
+  void broadCast(std::vector<Float> &x, UInt size, UInt idx, const std::vector<Bool> &usedRank);
+  void reduceSum(std::vector<Float> &x, UInt size, UInt idx, const std::vector<Bool> &usedRank);
 
 
   /* @brief Solve an triangular system of equations \f$ \mathbf{W}\mathbf{y} = \mathbf{x}\f$
@@ -65,6 +67,13 @@ class MatrixDistributed
   void triangularTransSolve(std::vector<Matrix> &x) {triangularTransSolve(x, 0, blockCount(), TRUE);}
   void triangularTransSolve(std::vector<Matrix> &x, UInt startBlock, UInt countBlock, Bool collect);
 
+  /* @brief Cholesky decomposition in single precision.
+  * The factor is stored in @a W (same indices as _N, column major), the blocks of N are not changed.
+  * Returns FALSE if the matrix is not positive definite in single precision. */
+  Bool choleskySingle(std::vector<std::vector<Float>> &W, Bool timing);
+  void triangularTransSolveSingle(const std::vector<std::vector<Float>> &W, std::vector<Matrix> &x);
+  void triangularSolveSingle(const std::vector<std::vector<Float>> &W, std::vector<Matrix> &x);
+
 public:
   /// Default constructor.
   MatrixDistributed();
@@ -156,6 +165,19 @@ public:
   * The input must be valid at master only. Output is valid at master only. */
   Matrix solve(const_MatrixSliceRef n, Bool timing=TRUE);
 
+  /** @brief Solve the system of equations \f$ \mathbf{N}\mathbf{x} = \mathbf{n}\f$ in mixed precision.
+  * The Cholesky decomposition is computed in single precision and the solution is improved
+  * by iterative refinement in double precision: \f$ \mathbf{r} = \mathbf{n}-\mathbf{N}\mathbf{x} \f$, \f$ \mathbf{x} += \mathbf{N}^{-1}\mathbf{r} \f$.
+  * The refinement stops if the relative change of all solution columns is below @p tolerance.
+  * The factor (including fill-in) is held in single precision in addition to the unchanged matrix,
+  * which is used for the residuals. After convergence the matrix is replaced by the factor.
+  * If it does not converge within @p maxIter iterations (or the decomposition fails),
+  * the Cholesky decomposition is recomputed in double precision.
+  * At output the matrix contains the Cholesky factor (single precision accuracy if converged).
+  * The input must be valid at master only. Output is valid at master only.
+  * @return solution vector(s) */
+  Matrix solveMixedPrecision(const_MatrixSliceRef n, Double tolerance=1e-12, UInt maxIter=10, Bool timing=TRUE);
+
   /** @brief Solve a triangular system of equations \f$ \mathbf{W}\mathbf{y} = \mathbf{x}\f$
   * \f$ \mathbf{W} \f$ is assumed to be an upper triangular matrix.
   * The input must be valid at master only. Output is valid at master only. */
@@ -188,6 +210,27 @@ public:
   * @param calcRank: function handler to determine the process rank of block(i,k) (default: block cyclic distribution). */
   void reorder(const std::vector<UInt> &index, const std::vector<UInt> &blockIndex, std::function<UInt(UInt, UInt, UInt)> calcRank=nullptr);
 
+  /** @brief Reorder the blocks of the matrix.
+  * The block sizes are moved with the blocks.
+  * @param order: old block index for each new block position.
+  * @return index vector of the parameters (see @a reorder). */
+  std::vector<UInt> reorderBlocks(const std::vector<UInt> &order);
+
+  /** @brief Fill-reducing order of the blocks.
+  * Minimum degree ordering of the block graph: blocks are nodes and used off-diagonal blocks are edges.
+  * The degree is weighted with the block sizes. Ties are resolved in the current order.
+  * @return old block index for each new block position (see @a reorderBlocks). */
+  std::vector<UInt> minimumDegreeBlockOrder() const;
+
+  /** @brief Symbolic Cholesky decomposition of the block structure.
+  * Predicts the used blocks of the Cholesky factor including fill-in without any computation.
+  * @param order: old block index for each new block position (empty: current order).
+  * @param dense: assume all blocks of the upper triangle are used (computed in closed form, also if all blocks are used).
+  * @param[out] elements: number of matrix elements of the used blocks of the factor.
+  * @param[out] flops: number of floating point operations of the decomposition.
+  * @return number of used blocks of the Cholesky factor. */
+  UInt symbolicCholesky(const std::vector<UInt> &order, Bool dense, Double &elements, Double &flops) const;
+
   // =========================================
 
   /** @brief Compute boundary indices for distributed blocks from parameter count and block size.
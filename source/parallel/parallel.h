@@ -146,6 +146,7 @@ namespace Parallel
   void reduceSum(Double  &x, UInt process=0, CommunicatorPtr comm=nullptr);
   void reduceSum(Bool    &x, UInt process=0, CommunicatorPtr comm=nullptr);
   void reduceSum(Matrix  &x, UInt process=0, CommunicatorPtr comm=nullptr);
+  void reduceSum(std::vector<Float> &x, UInt process=0, CommunicatorPtr comm=nullptr);
   ///@}
 
   /** @brief Find min/max of @a x at all processes (also rank 0) and send the result to @a process. */
@@ -823,6 +823,36 @@ void reduceSum(Matrix &x, UInt process, CommunicatorPtr comm)
   }
 }
 
+/***********************************************/
+
+void reduceSum(std::vector<Float> &x, UInt process, CommunicatorPtr comm)
+{
+  try
+  {
+    constexpr UInt BLOCKSIZE = 50*1024*1024/sizeof(Float); // 50 Mb
+
+    UInt index = 0;
+    while(index<x.size())
+    {
+      const UInt size = std::min(x.size()-index, BLOCKSIZE);
+      if(myRank(comm) == process)
+      {
+        std::vector<Float> tmp(size);
+        check(MPI_Reduce(x.data()+index, tmp.data(), size, MPI_FLOAT, MPI_SUM, process, getComm(comm)));
+        std::copy_n(tmp.data(), size, x.data()+index);
+      }
+      else
+        check(MPI_Reduce(x.data()+index, nullptr, size, MPI_FLOAT, MPI_SUM, process, getComm(comm)));
+
+      index += size;
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
 /***********************************************/
 /***********************************************/
 
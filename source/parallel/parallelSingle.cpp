@@ -67,6 +67,7 @@ void reduceSum(UInt     &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceSum(Double   &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceSum(Bool     &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceSum(Matrix   &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
+void reduceSum(std::vector<Float> &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceMin(UInt     &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceMin(Double   &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
 void reduceMax(UInt     &/*x*/, UInt /*process*/, CommunicatorPtr /*comm*/) {}
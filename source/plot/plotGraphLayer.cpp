@@ -36,6 +36,12 @@ is required and the color is determined by \config{valueZ}.
 Additionally a vertical error bar can be plotted at each data point with
 size \config{valueErrorBar}.
 
+Large data sets (e.g. long time series with high sampling) can be reduced with \config{decimate}
+to the resolution of the figure (\config{width}, \config{height}, and \config{dpi} of \config{options}).
+Lines keep the first, last, minimum, and maximum point of each pixel column,
+points keep the last (topmost) point in each pixel. The figure is not changed visually.
+Data with error bars is not reduced.
+
 See \program{Gravityfield2AreaMeanTimeSeries} for an example plot.
 )";
 
@@ -46,10 +52,12 @@ protected:
   PlotLinePtr   line;
   PlotSymbolPtr symbol;
   Bool          hasZValues, hasErrors;
+  Bool          decimation;
 
 public:
   PlotGraphLayerLinesAndPoints(Config &config);
   Bool requiresColorBar()   const override {return hasZValues;}
+  void decimate(Bool isLogX, Double minX, Double maxX, UInt pixelX, Bool isLogY, Double minY, Double maxY, UInt pixelY) override;
   std::string scriptEntry() const override;
   std::string legendEntry() const override;
 };
@@ -72,6 +80,7 @@ PlotGraphLayerLinesAndPoints::PlotGraphLayerLinesAndPoints(Config &config)
     readConfig(config, "line",             line,         Config::OPTIONAL, "solid", "");
     readConfig(config, "symbol",           symbol,       Config::OPTIONAL, "",      "");
     readConfig(config, "plotOnSecondAxis", onSecondAxis, Config::DEFAULT,  "0",     "draw dataset on a second Y-axis (if available).");
+    readConfig(config, "decimate",         decimation,   Config::DEFAULT,  "0",     "reduce data to the resolution of the figure");
     if(isCreateSchema(config)) return;
 
     hasZValues = symbol && symbol->requiresColorBar() && exprZ;
@@ -134,6 +143,95 @@ PlotGraphLayerLinesAndPoints::PlotGraphLayerLinesAndPoints(Config &config)
 
 /***********************************************/
 
+void PlotGraphLayerLinesAndPoints::decimate(Bool isLogX, Double minX, Double maxX, UInt pixelX, Bool isLogY, Double minY, Double maxY, UInt pixelY)
+{
+  try
+  {
+    if(!decimation || hasErrors || !pixelX || !pixelY || (data.rows() <= 4*pixelX))
+      return;
+
+    // pixel index, outside the interval: -1 or pixelCount
+    auto pixelIndex = [](Double x, Bool isLog, Double vmin, Double vmax, UInt pixelCount)
+    {
+      if(isLog)
+      {
+        x    = std::log(x);
+        vmin = std::log(vmin);
+        vmax = std::log(vmax);
+      }
+      return static_cast<Int>(std::max(-1., std::min(std::floor((x-vmin)/(vmax-vmin)*pixelCount), static_cast<Double>(pixelCount))));
+    };
+
+    std::vector<Int> column(data.rows()), row(data.rows());
+    std::vector<Bool> isValid(data.rows());
+    for(UInt i=0; i<data.rows(); i++)
+    {
+      isValid.at(i) = !std::isnan(data(i,0)) && !std::isnan(data(i,1)) && (!isLogX || (data(i,0) > 0)) && (!isLogY || (data(i,1) > 0));
+      if(isValid.at(i))
+      {
+        column.at(i) = pixelIndex(data(i,0), isLogX, minX, maxX, pixelX);
+        row.at(i)    = pixelIndex(data(i,1), isLogY, minY, maxY, pixelY);
+      }
+    }
+
+    std::vector<Bool> keep(data.rows(), FALSE);
+    for(UInt i=0; i<data.rows(); i++)
+      keep.at(i) = !isValid.at(i); // gaps in lines
+
+    // lines: first, last, min, and max point of consecutive points in the same pixel column
+    if(line)
+      for(UInt start=0; start<data.rows();)
+      {
+        if(!isValid.at(start))
+        {
+          start++;
+          continue;
+        }
+        UInt idMin = start, idMax = start;
+        UInt end = start+1;
+        for(; (end<data.rows()) && isValid.at(end) && (column.at(end) == column.at(start)); end++)
+        {
+          if(data(end,1) < data(idMin,1)) idMin = end;
+          if(data(end,1) > data(idMax,1)) idMax = end;
+        }
+        keep.at(start) = keep.at(end-1) = keep.at(idMin) = keep.at(idMax) = TRUE;
+        start = end;
+      }
+
+    // points: last point in each pixel is drawn on top
+    if(symbol)
+    {
+      std::vector<UInt> lastPoint(pixelX*pixelY, NULLINDEX);
+      for(UInt i=0; i<data.rows(); i++)
+      {
+        if(!isValid.at(i))
+          continue;
+        if((column.at(i) < 0) || (column.at(i) >= static_cast<Int>(pixelX)) || (row.at(i) < 0) || (row.at(i) >= static_cast<Int>(pixelY)))
+          keep.at(i) = TRUE; // symbols outside can be partly visible
+        else
+          lastPoint.at(column.at(i)*pixelY+row.at(i)) = i;
+      }
+      for(UInt idx : lastPoint)
+        if(idx != NULLINDEX)
+          keep.at(idx) = TRUE;
+    }
+
+    const UInt count = std::count(keep.begin(), keep.end(), TRUE);
+    Matrix A(count, data.columns());
+    for(UInt i=0, k=0; i<data.rows(); i++)
+      if(keep.at(i))
+        copy(data.row(i), A.row(k++));
+    logInfo<<"  decimated "<<data.rows()<<" data points to "<<A.rows()<<Log::endl;
+    data = A;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 std::string PlotGraphLayerLinesAndPoints::scriptEntry() const
 {
   try
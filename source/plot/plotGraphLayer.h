@@ -59,6 +59,11 @@ public:
   virtual void getIntervalX(Bool isLogarithmic, Double &minX, Double &maxX) const;
   virtual void getIntervalY(Bool isLogarithmic, Double minX, Double maxX, Double &minY, Double &maxY) const;
   virtual void getIntervalZ(Bool isLogarithmic, Double minX, Double maxX, Double minY, Double maxY, Double &minZ, Double &maxZ) const;
+
+  /** @brief Reduce the data to the resolution of the figure.
+  * The axis intervals are divided into @a pixelX and @a pixelY pixels.
+  * Only data not visible at this resolution is removed. */
+  virtual void decimate(Bool /*isLogX*/, Double /*minX*/, Double /*maxX*/, UInt /*pixelX*/, Bool /*isLogY*/, Double /*minY*/, Double /*maxY*/, UInt /*pixelY*/) {}
   virtual void writeDataFile(const FileName &workingDirectory, UInt idxLayer, Double minX, Double maxX, Double minY, Double maxY);
   virtual std::string scriptEntry() const = 0;
   virtual std::string legendEntry() const {return std::string();}
@@ -17,6 +17,7 @@
 #include "base/import.h"
 #include "parser/dataVariables.h"
 #include "config/configRegister.h"
+#include "inputOutput/logging.h"
 #include "inputOutput/system.h"
 #include "files/filePolygon.h"
 #include "files/fileGriddedData.h"
@@ -168,6 +169,11 @@ between the points. If no \configClass{color}{plotColorType} of the \configClass
 is given a \configClass{colorbar}{plotColorbarType} is required and the color is determined
 by the \config{value} expression. The standard \reference{dataVariables}{general.parser:dataVariables}
 are available to select the data column of \configFile{inputfileGriddedData}{griddedData}.
+
+Large data sets can be reduced with \config{decimate} to the resolution of the figure
+(\config{width}, \config{height}, and \config{dpi} of \config{options}).
+The points are binned into geographical cells of half the pixel size of the map boundary.
+Only the last (topmost) point of each cell and the end points of line segments within a cell are kept.
 )";
 
 class PlotMapLayerPoints : public PlotMapLayer
@@ -175,10 +181,12 @@ class PlotMapLayerPoints : public PlotMapLayer
   PlotLinePtr   line;
   PlotSymbolPtr symbol;
   Bool greatCircle;
+  Bool decimation;
 
 public:
   PlotMapLayerPoints(Config &config);
   Bool        requiresColorBar() const override {return data.columns();}
+  void        decimate(const Ellipsoid &ellipsoid, Angle minL, Angle maxL, Angle minB, Angle maxB, UInt pixelX, UInt pixelY) override;
   std::string scriptEntry() const override;
 };
 
@@ -196,6 +204,7 @@ PlotMapLayerPoints::PlotMapLayerPoints(Config &config)
     readConfig(config, "symbol",               symbol,       Config::OPTIONAL, "1",     "");
     readConfig(config, "line",                 line,         Config::OPTIONAL, "",      "style of connecting lines");
     readConfig(config, "drawLineAsGreatCircle",greatCircle,  Config::DEFAULT,  "1",     "draw connecting lines as great circles (otherwise, a straight line is drawn instead)");
+    readConfig(config, "decimate",             decimation,   Config::DEFAULT,  "0",     "reduce points to the resolution of the figure");
     if(isCreateSchema(config)) return;
 
     // tests
@@ -236,6 +245,71 @@ PlotMapLayerPoints::PlotMapLayerPoints(Config &config)
 
 /***********************************************/
 
+void PlotMapLayerPoints::decimate(const Ellipsoid &ellipsoid, Angle minL, Angle maxL, Angle minB, Angle maxB, UInt pixelX, UInt pixelY)
+{
+  try
+  {
+    if(!decimation || (points.size() <= pixelX*pixelY/100))
+      return;
+
+    // cells of half the pixel size (projections may stretch the map locally)
+    Double rangeL = maxL-minL;
+    if(rangeL <= 0)
+      rangeL += 2*PI;
+    const Double cellSize = 0.5*std::min(rangeL/pixelX, static_cast<Double>(maxB-minB)/pixelY);
+    if(!(cellSize > 0))
+      return;
+    const UInt countL = static_cast<UInt>(std::ceil(2*PI/cellSize));
+
+    std::vector<UInt> cell(points.size());
+    for(UInt i=0; i<points.size(); i++)
+    {
+      Angle  lon, lat;
+      Double h;
+      ellipsoid(points.at(i), lon, lat, h);
+      cell.at(i) = static_cast<UInt>(std::floor((lat+PI/2)/cellSize))*countL + static_cast<UInt>(std::floor((lon+PI)/cellSize)) % countL;
+    }
+
+    std::vector<Bool> keep(points.size(), FALSE);
+
+    // lines: end points of consecutive points in the same cell
+    if(line)
+      for(UInt i=0; i<points.size(); i++)
+        keep.at(i) = (i == 0) || (i+1 == points.size()) || (cell.at(i) != cell.at(i-1)) || (cell.at(i) != cell.at(i+1));
+
+    // points: last point in each cell is drawn on top
+    if(symbol)
+    {
+      std::map<UInt, UInt> lastPoint;
+      for(UInt i=0; i<points.size(); i++)
+        lastPoint[cell.at(i)] = i;
+      for(const auto &idx : lastPoint)
+        keep.at(idx.second) = TRUE;
+    }
+
+    const UInt count = std::count(keep.begin(), keep.end(), TRUE);
+    std::vector<Vector3d> pointsNew;
+    pointsNew.reserve(count);
+    Matrix dataNew(count, data.columns());
+    for(UInt i=0; i<points.size(); i++)
+      if(keep.at(i))
+      {
+        if(data.columns())
+          copy(data.row(i), dataNew.row(pointsNew.size()));
+        pointsNew.push_back(points.at(i));
+      }
+    logInfo<<"  decimated "<<points.size()<<" points to "<<pointsNew.size()<<Log::endl;
+    points = std::move(pointsNew);
+    data   = dataNew;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 std::string PlotMapLayerPoints::scriptEntry() const
 {
   try
@@ -54,6 +54,11 @@ public:
   virtual Bool requiresColorBar() const {return FALSE;}
   virtual void boundary(const Ellipsoid &ellipsoid, Angle &minL, Angle &maxL, Angle &minB, Angle &maxB) const;
   virtual void getIntervalZ(Bool isLogarithmic, Double &minZ, Double &maxZ) const;
+
+  /** @brief Reduce the data to the resolution of the figure.
+  * The map boundary is plotted with @a pixelX times @a pixelY pixels.
+  * Only data not visible at this resolution is removed. */
+  virtual void decimate(const Ellipsoid &/*ellipsoid*/, Angle /*minL*/, Angle /*maxL*/, Angle /*minB*/, Angle /*maxB*/, UInt /*pixelX*/, UInt /*pixelY*/) {}
   virtual void writeDataFile(const Ellipsoid &ellipsoid, const FileName &workingDirectory, UInt idxLayer);
   virtual std::string scriptStatisticsInfo(UInt fontSize, Double width, const FileName &workingDirectory, UInt idxLayer) const;
   virtual std::string scriptEntry() const = 0;
@@ -28,6 +28,7 @@ See also \program{GnssOrbex2StarCamera}.
 #include "classes/timeSeries/timeSeries.h"
 #include "files/fileStringTable.h"
 #include "inputOutput/system.h"
+#include "inputOutput/fixedWidthRecord.h"
 #include "misc/observation/variationalEquationFromFile.h"
 
 /***** CLASS ***********************************/
@@ -138,16 +139,19 @@ void GnssAttitude2Orbex::run(Config &config)
     outfile << "*ATT RECORDS: TRANSFORMATION FROM TERRESTRIAL FRAME COORDINATES (T) TO SAT. BODY FRAME ONES (B) SUCH AS" << std::endl;
     outfile << "*                                 (0,B) = q.(0,T).trans(q)" << std::endl;
     outfile << "*REC ID_              N ___q0_(scalar)_____ ____q1__x__________ ____q2__y__________ ____q3__z__________" << std::endl;
+    FixedWidthWriter writer;
     for(UInt idEpoch = 0; idEpoch < times.size(); idEpoch++)
     {
-      outfile << times.at(idEpoch)%"## %y %m %d %H %M %012.9S000 "s << transmitterList.size()%"%3i"s << std::endl; // ATTENTION: "fake" 15.12 precision due to max Time precision
+      writer.text("## ").date(times.at(idEpoch), 12, 9).text("000 ").integer(transmitterList.size(), 3).endLine(); // ATTENTION: "fake" 15.12 precision due to max Time precision
       for(const auto &prn : transmitterList)
       {
-        outfile << " ATT " << prn << std::string(14, ' ') << prn2Quaternions[prn].columns();
-        for(UInt i = 0; i < prn2Quaternions[prn].columns(); i++)
-          outfile << prn2Quaternions[prn](idEpoch, i)%" %19.16f"s;
-        outfile << std::endl;
+        const Matrix &quaternion = prn2Quaternions[prn];
+        writer.text(" ATT ").text(prn).spaces(14).text(std::to_string(quaternion.columns()));
+        for(UInt i = 0; i < quaternion.columns(); i++)
+          writer.text(' ').fixed(quaternion(idEpoch, i), 19, 16);
+        writer.endLine();
       }
+      writer.write(outfile);
     }
     outfile << "-EPHEMERIS/DATA" << std::endl;
     outfile << "*------------------------------------------------------------------------------------------------------" << std::endl;
@@ -26,6 +26,7 @@ See IGS clock RINEX format description for further details on header information
 #include "files/fileGnssSignalBias.h"
 #include "files/fileGnssStationInfo.h"
 #include "files/fileInstrument.h"
+#include "inputOutput/fixedWidthRecord.h"
 #include <chrono>
 
 /***** CLASS ***********************************/
@@ -70,7 +71,7 @@ public:
 private:
   void readSatelliteData(std::vector<SatelliteData> &data, std::map<Char, std::set<std::string>> &system2ObsTypes) const;
   void readStationData(std::vector<StationData> &data) const;
-  void writeEpoch(const Time &time, Char type, std::vector<DataPtr> &data, OutFile &file) const;
+  void writeEpoch(const Time &time, const std::string &timeStr, Char type, std::vector<DataPtr> &data, FixedWidthWriter &writer) const;
 
 public:
   void run(Config &config);
@@ -191,7 +192,7 @@ void GnssClock2ClockRinex::readStationData(std::vector<StationData> &data) const
 
 /***********************************************/
 
-void GnssClock2ClockRinex::writeEpoch(const Time &time, Char type, std::vector<DataPtr> &data, OutFile &file) const
+void GnssClock2ClockRinex::writeEpoch(const Time &time, const std::string &timeStr, Char type, std::vector<DataPtr> &data, FixedWidthWriter &writer) const
 {
   try
   {
@@ -200,7 +201,7 @@ void GnssClock2ClockRinex::writeEpoch(const Time &time, Char type, std::vector<D
       if(d->idEpoch >= d->times.size() || d->times.at(d->idEpoch) != time)
         continue; // no data for this epoch
 
-      file << 'A' << type << ' ' << d->identifier << ' '<< time%"%y %m %d %H %M %09.6S"s << 1%"% 3i"s << "   " << d->arc.at(d->idEpoch).value%"%19.12e"s << std::endl;
+      writer.text('A').text(type).text(' ').text(d->identifier).text(' ').text(timeStr).integer(1, 3).spaces(3).scientific(d->arc.at(d->idEpoch).value, 19, 12).endLine();
       d->idEpoch++;
     }
   }
@@ -357,12 +358,15 @@ void GnssClock2ClockRinex::run(Config &config)
       satelliteDataPtrs.push_back(std::make_shared<Data>(data));
     for(auto & data : stationData)
       stationDataPtrs.push_back(std::make_shared<Data>(data));
+    FixedWidthWriter writer;
     logTimerStart
     for(const auto &time : times)
     {
       logTimerLoop(++i, times.size())
-      writeEpoch(time, 'S', satelliteDataPtrs, file);
-      writeEpoch(time, 'R', stationDataPtrs,   file);
+      const std::string timeStr = FixedWidthWriter().date(time, 9, 6).str();
+      writeEpoch(time, timeStr, 'S', satelliteDataPtrs, writer);
+      writeEpoch(time, timeStr, 'R', stationDataPtrs,   writer);
+      writer.write(file);
     }
     logTimerLoopEnd(times.size());
   }
@@ -25,6 +25,7 @@ into an \file{instrument file (MISCVALUE)}{instrument} for each \config{identifi
 #include "programs/program.h"
 #include "base/string.h"
 #include "inputOutput/file.h"
+#include "inputOutput/fixedWidthRecord.h"
 #include "files/fileInstrument.h"
 #include "classes/timeSeries/timeSeries.h"
 
@@ -34,7 +35,14 @@ into an \file{instrument file (MISCVALUE)}{instrument} for each \config{identifi
 * @ingroup programsConversionGroup */
 class GnssClockRinex2InstrumentClock
 {
-  void readFile(const FileName &fileName, std::vector<std::string> identifier, std::vector<std::vector<Time>> &times, std::vector<std::vector<Double>> &clock) const;
+  class Data
+  {
+  public:
+    std::vector<std::vector<Time>>   times;
+    std::vector<std::vector<Double>> clocks;
+  };
+
+  static Data readFile(const FileName &fileName, const std::map<std::string, UInt> &lineId2Index, UInt identifierCount);
 
 public:
   void run(Config &config);
@@ -71,12 +79,34 @@ void GnssClockRinex2InstrumentClock::run(Config &config)
     std::vector<std::vector<Time>>   times(identifier.size());
     std::vector<std::vector<Double>> clocks(identifier.size());
 
-    for(UInt i=0; i<fileNameInClockRinex.size(); i++)
+    // record identifier ("AS G23", "AR ALIC") -> index
+    std::map<std::string, UInt> lineId2Index;
+    for(UInt i=0; i<identifier.size(); i++)
     {
-      logStatus<<"Read file <"<<fileNameInClockRinex.at(i)<<">"<<Log::endl;
-      readFile(fileNameInClockRinex.at(i), identifier, times, clocks);
+      lineId2Index.insert({"AS "+String::upperCase(identifier.at(i)), i});
+      lineId2Index.insert({"AR "+String::upperCase(identifier.at(i)), i});
     }
 
+    // files are read concurrently, results are appended in order
+    readFilesConcurrently(fileNameInClockRinex.size(), [&](UInt i) {return readFile(fileNameInClockRinex.at(i), lineId2Index, identifier.size());},
+                          [&](UInt i, const Data &data)
+    {
+      logStatus<<"Read file <"<<fileNameInClockRinex.at(i)<<">"<<Log::endl;
+      for(UInt idx=0; idx<identifier.size(); idx++)
+        for(UInt k=0; k<data.times.at(idx).size(); k++)
+        {
+          const Time &time = data.times.at(idx).at(k);
+          if(times.at(idx).size() && (time<times.at(idx).back()))
+            throw(Exception("epochs not in increasing order"));
+          if((times.at(idx).size()==0) || (time>times.at(idx).back()))
+          {
+            times.at(idx).push_back(time);
+            clocks.at(idx).push_back(data.clocks.at(idx).at(k));
+          }
+        }
+      return TRUE;
+    });
+
     // Conversion
     // ----------
     const std::vector<Time> timesInterval = timesIntervalPtr->times();
@@ -129,7 +159,7 @@ void GnssClockRinex2InstrumentClock::run(Config &config)
 
 /***********************************************/
 
-void GnssClockRinex2InstrumentClock::readFile(const FileName &fileName, std::vector<std::string> identifier, std::vector<std::vector<Time>> &times, std::vector<std::vector<Double>> &clock) const
+GnssClockRinex2InstrumentClock::Data GnssClockRinex2InstrumentClock::readFile(const FileName &fileName, const std::map<std::string, UInt> &lineId2Index, UInt identifierCount)
 {
   try
   {
@@ -141,50 +171,46 @@ void GnssClockRinex2InstrumentClock::readFile(const FileName &fileName, std::vec
     while(std::getline(file, line))
     {
       if(line.find("RINEX VERSION / TYPE") != std::string::npos)
-        fileVersion = String::toDouble(line.substr(0,20));
+        fileVersion = FixedWidthRecord(line).toDouble(0, 20);
 
       if(line.find("END OF HEADER") != std::string::npos)
         break;
     }
 
-    for(auto &&id : identifier)
-      std::transform(id.begin(), id.end(), id.begin(), ::toupper);
-
     // read data
     // ---------
-    UInt v3Offset = (fileVersion >= 3. ? 5 : 0);
+    Data data;
+    data.times.resize(identifierCount);
+    data.clocks.resize(identifierCount);
+    const UInt v3Offset = (fileVersion >= 3. ? 5 : 0);
+    std::string lineID;
     while(std::getline(file, line))
     {
-      std::string lineID = line.substr(0,7+v3Offset);
-      lineID.erase(std::find_if(lineID.rbegin(), lineID.rend(), std::not1(std::ptr_fun<int, int>(std::isspace))).base(), lineID.end()); // right trim spaces
+      lineID.assign(line, 0, 7+v3Offset);
+      lineID.erase(std::find_if(lineID.rbegin(), lineID.rend(), [](Char c) {return !std::isspace(c);}).base(), lineID.end()); // right trim spaces
       std::transform(lineID.begin(), lineID.end(), lineID.begin(), ::toupper);
 
-      auto iter = std::find_if(identifier.begin(), identifier.end(), [lineID](std::string id)
+      auto iter = lineId2Index.find(lineID);
+      if(iter != lineId2Index.end())
       {
-        return (lineID=="AS "+id || lineID=="AR "+id); }
-      );
-      if(iter != identifier.end())
-      {
-        UInt   year  = String::toInt(line.substr(v3Offset+8, 4));
-        UInt   month = String::toInt(line.substr(v3Offset+13, 2));
-        UInt   day   = String::toInt(line.substr(v3Offset+16, 2));
-        UInt   hour  = String::toInt(line.substr(v3Offset+19, 2));
-        UInt   min   = String::toInt(line.substr(v3Offset+22, 2));
-        Double sec   = String::toDouble(line.substr(v3Offset+24, 10));
-        Double clk   = String::toDouble(line.substr(v3Offset+40, 19));
-        Time   time  = date2time(year,month,day,hour,min,sec);
-
-        UInt idx = static_cast<UInt>(std::distance(identifier.begin(), iter));
-        if(times.at(idx).size() && (time<times.at(idx).back()))
+        FixedWidthRecord record(line);
+        const Time time = date2time(record.toInt(v3Offset+8, 4), record.toInt(v3Offset+13, 2), record.toInt(v3Offset+16, 2),
+                                    record.toInt(v3Offset+19, 2), record.toInt(v3Offset+22, 2), record.toDouble(v3Offset+24, 10));
+        const Double clk = record.toDouble(v3Offset+40, 19);
+
+        const UInt idx = iter->second;
+        if(data.times.at(idx).size() && (time<data.times.at(idx).back()))
           throw(Exception("epochs not in increasing order"));
 
-        if((times.at(idx).size()==0) || (time>times.at(idx).back()))
+        if((data.times.at(idx).size()==0) || (time>data.times.at(idx).back()))
         {
-          times.at(idx).push_back(time);
-          clock.at(idx).push_back(clk);
+          data.times.at(idx).push_back(time);
+          data.clocks.at(idx).push_back(clk);
         }
       }
     } // for(;;)
+
+    return data;
   }
   catch(std::exception &e)
   {
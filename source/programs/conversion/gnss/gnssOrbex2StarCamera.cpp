@@ -23,7 +23,8 @@ See also \program{GnssAttitude2Orbex}.
 /***********************************************/
 
 #include "programs/program.h"
-#include "base/string.h"
+#include "inputOutput/file.h"
+#include "inputOutput/fixedWidthRecord.h"
 #include "classes/earthRotation/earthRotation.h"
 #include "files/fileInstrument.h"
 
@@ -64,32 +65,31 @@ void GnssOrbex2StarCamera::run(Config &config)
     Rotary3d crf2trf;
     while(std::getline(file, line))
     {
-      if(String::startsWith(line, "+EPHEMERIS/DATA"))
+      const FixedWidthRecord record(line);
+      if(record.startsWith("+EPHEMERIS/DATA"))
       {
         isDataBlock = TRUE;
         continue;
       }
-      if(String::startsWith(line, "-EPHEMERIS/DATA"))
+      if(record.startsWith("-EPHEMERIS/DATA"))
         isDataBlock = FALSE;
-      if(!isDataBlock || String::startsWith(line, "*"))
+      if(!isDataBlock || record.startsWith("*"))
         continue;
 
-      if(String::startsWith(line, "##"))
+      if(record.startsWith("##"))
       {
-        time = date2time(String::toInt(line.substr(3,4)), String::toInt(line.substr(8,2)), String::toInt(line.substr(11,2)),
-                         String::toInt(line.substr(14,2)), String::toInt(line.substr(17,2)), String::toDouble(line.substr(20,15)));
+        time = date2time(record.toInt(3,4), record.toInt(8,2), record.toInt(11,2), record.toInt(14,2), record.toInt(17,2), record.toDouble(20,15));
         if(earthRotation)
           crf2trf = earthRotation->rotaryMatrix(time);
       }
 
-      if(String::startsWith(line, " ATT"))
+      if(record.startsWith(" ATT"))
       {
-        std::string id = line.substr(5,3);
+        std::string id = record.string(5,3);
         if(identifiers.size() && std::find(identifiers.begin(), identifiers.end(), id) == identifiers.end())
           continue;
 
-        Rotary3d trf2sat(Vector({String::toDouble(line.substr(24,19)), String::toDouble(line.substr(44,19)),
-                             String::toDouble(line.substr(64,19)), String::toDouble(line.substr(84,19))}));
+        Rotary3d trf2sat(Vector({record.toDouble(24,19), record.toDouble(44,19), record.toDouble(64,19), record.toDouble(84,19)}));
         StarCameraEpoch epoch;
         epoch.time = time;
         epoch.rotary = inverse(trf2sat * crf2trf); // (trf/crf2sat --> sat2trf/crf)
@@ -20,8 +20,8 @@ at epochs given by \configClass{timeSeries}{timeSeriesType} and writes them to \
 /***********************************************/
 
 #include "programs/program.h"
-#include "base/string.h"
 #include "inputOutput/file.h"
+#include "inputOutput/fixedWidthRecord.h"
 #include "files/fileInstrument.h"
 #include "classes/timeSeries/timeSeries.h"
 
@@ -134,7 +134,7 @@ void GnssRinexNavigation2OrbitClock::readHeader(InFile &file, UInt lineCount)
     std::string line, label;
     getLine(file, line, label);
     testLabel(label, "RINEX VERSION / TYPE", FALSE);
-    rinexVersion    = String::toDouble(line.substr(0, 9));
+    rinexVersion    = FixedWidthRecord(line).toDouble(0, 9);
     if(rinexVersion<2)
       logWarning << "old RINEX version: " << rinexVersion << Log::endl;
     if(line.at(20) != 'N' && !(rinexVersion < 3 && line.at(20) == 'G'))
@@ -145,6 +145,7 @@ void GnssRinexNavigation2OrbitClock::readHeader(InFile &file, UInt lineCount)
     {
       if(!getLine(file, line, label))
         throw(Exception("error while reading RINEX header"));
+      const FixedWidthRecord record(line);
       if(std::all_of(line.begin(), line.end(), isspace))
       {
         if(rinexVersion < 2)
@@ -168,28 +169,28 @@ void GnssRinexNavigation2OrbitClock::readHeader(InFile &file, UInt lineCount)
       {
         ionAlpha = Vector(4);
         for(UInt i = 0; i < ionAlpha.size(); i++)
-          ionAlpha(i) = String::toDouble(line.substr(2+i*12, 12));
+          ionAlpha(i) = record.toDouble(2+i*12, 12);
       }
       // ====================================
       else if(testLabel(label, "ION BETA"))
       {
         ionBeta = Vector(4);
         for(UInt i = 0; i < ionBeta.size(); i++)
-          ionBeta(i) = String::toDouble(line.substr(2+i*12, 12));
+          ionBeta(i) = record.toDouble(2+i*12, 12);
       }
       // ====================================
       else if(testLabel(label, "DELTA-UTC: A0,A1,T,W"))
       {
         deltaUTC = Vector(4);
-        deltaUTC(0) = String::toDouble(line.substr(3, 19));
-        deltaUTC(1) = String::toDouble(line.substr(22, 19));
-        deltaUTC(2) = String::toInt(line.substr(41, 9));
-        deltaUTC(3) = String::toInt(line.substr(50, 9));
+        deltaUTC(0) = record.toDouble(3, 19);
+        deltaUTC(1) = record.toDouble(22, 19);
+        deltaUTC(2) = record.toInt(41, 9);
+        deltaUTC(3) = record.toInt(50, 9);
       }
       // ====================================
       else if(testLabel(label, "LEAP SECONDS"))
       {
-        leapSeconds = String::toInt(line.substr(0, 6));
+        leapSeconds = record.toInt(0, 6);
       }
       // ====================================
       else if(testLabel(label, "CORR TO SYSTEM TIME"))
@@ -227,6 +228,7 @@ void GnssRinexNavigation2OrbitClock::readData(InFile &file)
   {
     while(getLine(file, line, label))
     {
+      const FixedWidthRecord record(line);
       std::string prnStr = rinexVersion < 3 ? system+line.substr(0,2): line.substr(0,3);
       if(prnStr.at(1) == ' ') prnStr.at(1) = '0';
       GnssType prn("***" + prnStr);
@@ -234,12 +236,12 @@ void GnssRinexNavigation2OrbitClock::readData(InFile &file)
       const UInt lineCount = (prn == GnssType::GLONASS || prn == GnssType::SBAS) ? 3 : (rinexVersion < 2 ? 6 : 7);
 
       // epoch
-      Int year   = String::toInt(line.substr(rinexVersion < 3 ?  3 :  4, rinexVersion < 3 ? 2 : 4));
-      Int month  = String::toInt(line.substr(rinexVersion < 3 ?  6 :  9, 2));
-      Int day    = String::toInt(line.substr(rinexVersion < 3 ?  9 : 12, 2));
-      Int hour   = String::toInt(line.substr(rinexVersion < 3 ? 12 : 15, 2));
-      Int minute = String::toInt(line.substr(rinexVersion < 3 ? 15 : 18, 2));
-      Double sec = String::toDouble(line.substr(rinexVersion < 3 ? 17 : 21, rinexVersion < 3 ? 5 : 2));
+      Int year   = record.toInt(rinexVersion < 3 ?  3 :  4, rinexVersion < 3 ? 2 : 4);
+      Int month  = record.toInt(rinexVersion < 3 ?  6 :  9, 2);
+      Int day    = record.toInt(rinexVersion < 3 ?  9 : 12, 2);
+      Int hour   = record.toInt(rinexVersion < 3 ? 12 : 15, 2);
+      Int minute = record.toInt(rinexVersion < 3 ? 15 : 18, 2);
+      Double sec = record.toDouble(rinexVersion < 3 ? 17 : 21, rinexVersion < 3 ? 5 : 2);
       if(rinexVersion < 3)
         year += ((year<=80) ? 2000 : 1900);
       const Time time = date2time(year, month, day, hour, minute, sec);
@@ -256,7 +258,7 @@ void GnssRinexNavigation2OrbitClock::readData(InFile &file)
       // clock polynomial
       Vector clockParam((prn != GnssType::GLONASS && prn != GnssType::SBAS) ? 3 : 2);
       for(UInt i = 0; i < clockParam.size(); i++)
-        clockParam(i) = String::toDouble(line.substr((rinexVersion < 3 ? 22 : 23)+i*19, 19));
+        clockParam(i) = record.toDouble((rinexVersion < 3 ? 22 : 23)+i*19, 19);
       satellites[prn].clockParam.push_back(clockParam);
 
       // orbit parameters
@@ -264,8 +266,9 @@ void GnssRinexNavigation2OrbitClock::readData(InFile &file)
       for(UInt i = 0; i < lineCount; i++)
       {
         getLine(file, line, label);
+        const FixedWidthRecord recordParam(line);
         for(UInt j = 0; j < 4; j++)
-          orbitParam(i,j) = String::toDouble(line.substr((rinexVersion < 3 ? 3 : 4)+j*19, 19));
+          orbitParam(i,j) = recordParam.toDouble((rinexVersion < 3 ? 3 : 4)+j*19, 19);
       }
       satellites[prn].orbitParam.push_back(orbitParam);
     }
@@ -28,6 +28,7 @@ See also \program{Sp3Format2Orbit}.
 
 #include "programs/program.h"
 #include "inputOutput/file.h"
+#include "inputOutput/fixedWidthRecord.h"
 #include "files/fileInstrument.h"
 #include "classes/earthRotation/earthRotation.h"
 #include "classes/gravityfield/gravityfield.h"
@@ -188,12 +189,14 @@ void Orbit2Sp3Format::run(Config &config)
         file<<"/* CCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCCC"<<std::endl;
     }
 
+    FixedWidthWriter writer;
+    const UInt precision = useSp3k ? 7 : 6;
     logTimerStart;
     for(UInt i=0; i<times.size(); i++)
     {
       logTimerLoop(i, times.size());
 
-      file<<"*  "<<times.at(i)%"%y %m %d %H %M %011.8S"s<<std::endl;
+      writer.text("*  ").date(times.at(i), 11, 8).endLine();
 
       Rotary3d rot;
       Vector3d omega;
@@ -214,19 +217,18 @@ void Orbit2Sp3Format::run(Config &config)
           continue; // no data for this epoch
 
         const Vector3d position = rot.rotate(satellite.orbit.at(satellite.idEpoch).position) + cm2ceCorrection;
-        const std::string clock = satellite.clock.size() ? (satellite.clock.at(satellite.idEpoch).value*1e6)%"%14.6f"s : " 999999.999999";
-        if(useSp3k)
-          file<<"P"<<satellite.identifier<<(position.x()/1000)%"%14.7f"s<<(position.y()/1000)%"%14.7f"s<<(position.z()/1000)%"%14.7f"s<<clock<<"             "<<std::endl;
+        writer.text('P').text(satellite.identifier).fixed(position.x()/1000, 14, precision).fixed(position.y()/1000, 14, precision).fixed(position.z()/1000, 14, precision);
+        if(satellite.clock.size())
+          writer.fixed(satellite.clock.at(satellite.idEpoch).value*1e6, 14, 6);
         else
-          file<<"P"<<satellite.identifier<<(position.x()/1000)%"%14.6f"s<<(position.y()/1000)%"%14.6f"s<<(position.z()/1000)%"%14.6f"s<<clock<<"             "<<std::endl;
+          writer.text(" 999999.999999");
+        writer.spaces(13).endLine();
 
         if(writeVel)
         {
           const Vector3d velocity = rot.rotate(satellite.orbit.at(satellite.idEpoch).velocity-crossProduct(omega, satellite.orbit.at(satellite.idEpoch).position));
-          if(useSp3k)
-            file<<"V"<<satellite.identifier<<(velocity.x()*10)%"%14.7f"s<<(velocity.y()*10)%"%14.7f"s<<(velocity.z()*10)%"%14.7f 999999.999999             "s<<std::endl;
-          else
-            file<<"V"<<satellite.identifier<<(velocity.x()*10)%"%14.6f"s<<(velocity.y()*10)%"%14.6f"s<<(velocity.z()*10)%"%14.6f 999999.999999             "s<<std::endl;
+          writer.text('V').text(satellite.identifier).fixed(velocity.x()*10, 14, precision).fixed(velocity.y()*10, 14, precision).fixed(velocity.z()*10, 14, precision)
+                .text(" 999999.999999             ").endLine();
         }
 
         if(satellite.cov.size())
@@ -234,30 +236,31 @@ void Orbit2Sp3Format::run(Config &config)
           Tensor3d cv = earthRotation ? rot.rotate(satellite.cov.at(satellite.idEpoch).covariance) : satellite.cov.at(satellite.idEpoch).covariance;
           if(useSp3k)
           {
-            file<<"EPx "
-                <<std::min(1000*std::sqrt(cv.xx()), 99.)%"%4.1f "s
-                <<std::min(1000*std::sqrt(cv.yy()), 99.)%"%4.1f "s
-                <<std::min(1000*std::sqrt(cv.zz()), 99.)%"%4.1f "s;
+            writer.text("EPx ")
+                  .fixed(std::min(1000*std::sqrt(cv.xx()), 99.), 4, 1).text(' ')
+                  .fixed(std::min(1000*std::sqrt(cv.yy()), 99.), 4, 1).text(' ')
+                  .fixed(std::min(1000*std::sqrt(cv.zz()), 99.), 4, 1).text(' ');
           }
           else
           {
-            file<<"EP  "
-                <<std::min(std::round(1000*std::sqrt(cv.xx())), 9999.)%"%4i "s
-                <<std::min(std::round(1000*std::sqrt(cv.yy())), 9999.)%"%4i "s
-                <<std::min(std::round(1000*std::sqrt(cv.zz())), 9999.)%"%4i "s;
+            writer.text("EP  ")
+                  .integer(static_cast<Int>(std::min(std::round(1000*std::sqrt(cv.xx())), 9999.)), 4).text(' ')
+                  .integer(static_cast<Int>(std::min(std::round(1000*std::sqrt(cv.yy())), 9999.)), 4).text(' ')
+                  .integer(static_cast<Int>(std::min(std::round(1000*std::sqrt(cv.zz())), 9999.)), 4).text(' ');
           }
-          file<<"        " // clk-sdev
-              <<std::min(std::round(10000000*cv.xy()/(std::sqrt(cv.xx())*std::sqrt(cv.yy()))), 99999999.)%"%8.0f "s
-              <<std::min(std::round(10000000*cv.xz()/(std::sqrt(cv.xx())*std::sqrt(cv.zz()))), 99999999.)%"%8.0f "s
-              <<"         " // xc
-              <<std::min(std::round(10000000*cv.yz()/(std::sqrt(cv.yy())*std::sqrt(cv.zz()))), 99999999.)%"%8.0f "s
-              <<"         " // yc
-              <<"         " // zc
-              <<std::endl;
+          writer.spaces(8) // clk-sdev
+                .fixed(std::min(std::round(10000000*cv.xy()/(std::sqrt(cv.xx())*std::sqrt(cv.yy()))), 99999999.), 8, 0).text(' ')
+                .fixed(std::min(std::round(10000000*cv.xz()/(std::sqrt(cv.xx())*std::sqrt(cv.zz()))), 99999999.), 8, 0).text(' ')
+                .spaces(9) // xc
+                .fixed(std::min(std::round(10000000*cv.yz()/(std::sqrt(cv.yy())*std::sqrt(cv.zz()))), 99999999.), 8, 0).text(' ')
+                .spaces(9) // yc
+                .spaces(9) // zc
+                .endLine();
         }
 
         satellite.idEpoch++;
       }
+      writer.write(file);
     }
     logTimerLoopEnd(times.size());
 
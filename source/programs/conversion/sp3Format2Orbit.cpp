@@ -28,8 +28,8 @@ See also \program{Orbit2Sp3Format}.
 /***********************************************/
 
 #include "programs/program.h"
-#include "base/string.h"
 #include "inputOutput/file.h"
+#include "inputOutput/fixedWidthRecord.h"
 #include "files/fileInstrument.h"
 #include "classes/earthRotation/earthRotation.h"
 
@@ -39,6 +39,19 @@ See also \program{Orbit2Sp3Format}.
 * @ingroup programsConversionGroup */
 class Sp3Format2Orbit
 {
+  class Data
+  {
+  public:
+    OrbitArc        orbit;
+    MiscValueArc    clock;
+    Covariance3dArc cov;
+    std::vector<std::string> warnings;
+    std::string     error; // reading stopped
+  };
+
+  static std::string satelliteIdentifier(const FileName &fileName);
+  static Data readFile(const FileName &fileName, const std::string &satId);
+
 public:
   void run(Config &config);
 };
@@ -68,132 +81,37 @@ void Sp3Format2Orbit::run(Config &config)
 
     // ==============================
 
-    OrbitArc        orbit;
-    MiscValueArc    clock;
-    Covariance3dArc cov;
-    for(FileName &filenameIn : fileNamesIn)
+    // first satellite in header
+    for(UInt i=0; (i<fileNamesIn.size()) && satId.empty(); i++)
     {
       try
       {
-        logStatus<<"read file <"<<filenameIn<<">"<<Log::endl;
-        InFile file(filenameIn);
-        std::string line;
-        enum TimeSystem {GPS, UTC, TAI};
-        TimeSystem timeSystem = GPS;
-        Time time;
-        Bool positionRecord = FALSE;
-        while(std::getline(file, line))
-        {
-          // Header
-          // ------
-          if(String::startsWith(line, "#") ||   // first 2 lines
-             String::startsWith(line, "/*") ||  // comment lines
-             String::startsWith(line, "%f") ||  // floating point base base numbers
-             String::startsWith(line, "%i"))    // additional parameters
-            continue;
-
-          if(String::startsWith(line, "+"))     // satellite list and orbit accuracy lines
-          {
-            if(satId.empty() && String::toInt(line.substr(3, 3)) > 0)
-              satId = line.substr(9, 3);
-            continue;
-          }
-
-          if(String::startsWith(line, "%c"))    // file type and time system definition lines
-          {
-            if(line.substr(9, 3) == "GPS") timeSystem = GPS;
-            else if(line.substr(9, 3) == "UTC") timeSystem = UTC;
-            else if(line.substr(9, 3) == "TAI") timeSystem = TAI;
-            else logWarning<<"Unknown time system ("<<line.substr(9, 3)<<"), assuming GPS time"<<Log::endl;
-            std::getline(file, line); // skip second %c line
-            continue;
-          }
-
-          // Epoch
-          // -----
-          if(String::startsWith(line, "* "))
-          {
-            UInt   year  = String::toInt(line.substr(3, 4));
-            UInt   month = String::toInt(line.substr(8, 2));
-            UInt   day   = String::toInt(line.substr(11, 2));
-            UInt   hour  = String::toInt(line.substr(14, 2));
-            UInt   min   = String::toInt(line.substr(17, 2));
-            Double sec   = String::toDouble(line.substr(20, 11));
-            time = date2time(year, month, day, hour, min, sec);
-            if(timeSystem == UTC)
-              time = timeUTC2GPS(time);
-            else if(timeSystem == TAI)
-              time -= seconds2time(DELTA_TAI_GPS);
-            positionRecord = FALSE;
-          }
-
-          // Position
-          // --------
-          if(String::startsWith(line, "P"))
-          {
-            if(line.substr(1,3) != satId)
-              positionRecord = FALSE;
-            else
-            {
-              positionRecord = TRUE;
-              Double x = String::toDouble(line.substr(4, 14));
-              Double y = String::toDouble(line.substr(18, 14));
-              Double z = String::toDouble(line.substr(32, 14));
-              Double c = String::toDouble(line.substr(46, 14));
-
-              OrbitEpoch epoch;
-              epoch.time     = time;
-              epoch.position = 1e3*Vector3d(x,y,z); // km -> m
-              orbit.push_back(epoch);
-              if(c < 999999)
-              {
-                MiscValueEpoch epoch;
-                epoch.time  = time;
-                epoch.value = 1e-6*c; // microsecond -> second
-                clock.push_back(epoch);
-              }
-            }
-          }
-
-          // Position covariance
-          // -------------------
-          if(String::startsWith(line, "EP") && positionRecord)
-          {
-            Double xx = String::toDouble(line.substr(4, 4));
-            Double yy = String::toDouble(line.substr(9, 4));
-            Double zz = String::toDouble(line.substr(14, 4));
-            Double xy = String::toDouble(line.substr(27, 8));
-            Double xz = String::toDouble(line.substr(36, 8));
-            Double yz = String::toDouble(line.substr(54, 8));
-            Covariance3dEpoch epochCov;
-            epochCov.time = time;
-            // mm -> m, correlation [1e-7] -> covariance
-            epochCov.setData(Vector({std::pow(1e-3*xx,2), std::pow(1e-3*yy,2), std::pow(1e-3*zz,2), 1e-13*xy*xx*yy, 1e-13*xz*xx*zz, 1e-13*yz*yy*zz}));
-            cov.push_back(epochCov);
-          }
-
-          // Velocity
-          // --------
-          if(String::startsWith(line, "V") && (line.substr(1,3) == satId) && positionRecord)
-          {
-            Double x = String::toDouble(line.substr(4, 14));
-            Double y = String::toDouble(line.substr(18, 14));
-            Double z = String::toDouble(line.substr(32, 14));
-            orbit.at(orbit.size()-1).velocity = 0.1*Vector3d(x,y,z);  // dm/s -> m/s
-          }
-
-          // end of file
-          // -----------
-          if(String::startsWith(line, "EOF"))
-            break;
-        } // for(;;)
+        satId = satelliteIdentifier(fileNamesIn.at(i));
       }
-      catch(std::exception &e)
+      catch(std::exception &/*e*/)
       {
-        logWarning<<std::endl<<e.what()<<" continue..."<<Log::endl;
-        break;
+        break; // reported while reading the data
       }
-    } // for(inputFiles)
+    }
+
+    // files are read concurrently, results are appended in order
+    OrbitArc        orbit;
+    MiscValueArc    clock;
+    Covariance3dArc cov;
+    readFilesConcurrently(fileNamesIn.size(), [&](UInt i) {return readFile(fileNamesIn.at(i), satId);},
+                          [&](UInt i, const Data &data)
+    {
+      logStatus<<"read file <"<<fileNamesIn.at(i)<<">"<<Log::endl;
+      for(const auto &warning : data.warnings)
+        logWarning<<warning<<Log::endl;
+      orbit.append(data.orbit);
+      clock.append(data.clock);
+      cov.append(data.cov);
+      if(data.error.empty())
+        return TRUE;
+      logWarning<<std::endl<<data.error<<" continue..."<<Log::endl;
+      return FALSE;
+    });
 
     if(orbit.size() == 0)
       throw(Exception("empty arc"));
@@ -255,3 +173,143 @@ void Sp3Format2Orbit::run(Config &config)
 
 /***********************************************/
 /***********************************************/
+
+std::string Sp3Format2Orbit::satelliteIdentifier(const FileName &fileName)
+{
+  try
+  {
+    InFile file(fileName);
+    std::string line;
+    while(std::getline(file, line))
+    {
+      FixedWidthRecord record(line);
+      if(record.startsWith("* "))  // first epoch
+        break;
+      if(record.startsWith("+") && !record.startsWith("++") && (record.toInt(3, 3) > 0))
+        return record.string(9, 3);
+    }
+    return std::string();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Sp3Format2Orbit::Data Sp3Format2Orbit::readFile(const FileName &fileName, const std::string &satId)
+{
+  Data data;
+  try
+  {
+    InFile file(fileName);
+    std::string line;
+    enum TimeSystem {GPS, UTC, TAI};
+    TimeSystem timeSystem = GPS;
+    Time time;
+    Bool positionRecord = FALSE;
+    while(std::getline(file, line))
+    {
+      FixedWidthRecord record(line);
+
+      // Header
+      // ------
+      if(record.startsWith("#") ||   // first 2 lines
+         record.startsWith("/*") ||  // comment lines
+         record.startsWith("%f") ||  // floating point base base numbers
+         record.startsWith("%i") ||  // additional parameters
+         record.startsWith("+"))     // satellite list and orbit accuracy lines
+        continue;
+
+      if(record.startsWith("%c"))    // file type and time system definition lines
+      {
+        if(record.isEqual(9, 3, "GPS")) timeSystem = GPS;
+        else if(record.isEqual(9, 3, "UTC")) timeSystem = UTC;
+        else if(record.isEqual(9, 3, "TAI")) timeSystem = TAI;
+        else data.warnings.push_back("Unknown time system ("+record.string(9, 3)+"), assuming GPS time");
+        std::getline(file, line); // skip second %c line
+        continue;
+      }
+
+      // Epoch
+      // -----
+      if(record.startsWith("* "))
+      {
+        time = date2time(record.toInt(3, 4), record.toInt(8, 2), record.toInt(11, 2), record.toInt(14, 2), record.toInt(17, 2), record.toDouble(20, 11));
+        if(timeSystem == UTC)
+          time = timeUTC2GPS(time);
+        else if(timeSystem == TAI)
+          time -= seconds2time(DELTA_TAI_GPS);
+        positionRecord = FALSE;
+      }
+
+      // Position
+      // --------
+      if(record.startsWith("P"))
+      {
+        if(!record.isEqual(1, 3, satId.c_str()))
+          positionRecord = FALSE;
+        else
+        {
+          positionRecord = TRUE;
+          const Double x = record.toDouble(4, 14);
+          const Double y = record.toDouble(18, 14);
+          const Double z = record.toDouble(32, 14);
+          const Double c = record.toDouble(46, 14);
+
+          OrbitEpoch epoch;
+          epoch.time     = time;
+          epoch.position = 1e3*Vector3d(x,y,z); // km -> m
+          data.orbit.push_back(epoch);
+          if(c < 999999)
+          {
+            MiscValueEpoch epoch;
+            epoch.time  = time;
+            epoch.value = 1e-6*c; // microsecond -> second
+            data.clock.push_back(epoch);
+          }
+        }
+      }
+
+      // Position covariance
+      // -------------------
+      if(record.startsWith("EP") && positionRecord)
+      {
+        const Double xx = record.toDouble(4, 4);
+        const Double yy = record.toDouble(9, 4);
+        const Double zz = record.toDouble(14, 4);
+        const Double xy = record.toDouble(27, 8);
+        const Double xz = record.toDouble(36, 8);
+        const Double yz = record.toDouble(54, 8);
+        Covariance3dEpoch epochCov;
+        epochCov.time = time;
+        // mm -> m, correlation [1e-7] -> covariance
+        epochCov.setData(Vector({std::pow(1e-3*xx,2), std::pow(1e-3*yy,2), std::pow(1e-3*zz,2), 1e-13*xy*xx*yy, 1e-13*xz*xx*zz, 1e-13*yz*yy*zz}));
+        data.cov.push_back(epochCov);
+      }
+
+      // Velocity
+      // --------
+      if(record.startsWith("V") && record.isEqual(1, 3, satId.c_str()) && positionRecord)
+      {
+        const Double x = record.toDouble(4, 14);
+        const Double y = record.toDouble(18, 14);
+        const Double z = record.toDouble(32, 14);
+        data.orbit.at(data.orbit.size()-1).velocity = 0.1*Vector3d(x,y,z);  // dm/s -> m/s
+      }
+
+      // end of file
+      // -----------
+      if(record.startsWith("EOF"))
+        break;
+    } // for(;;)
+  }
+  catch(std::exception &e)
+  {
+    data.error = e.what();
+  }
+  return data;
+}
+
+/***********************************************/
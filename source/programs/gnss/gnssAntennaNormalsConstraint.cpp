@@ -42,6 +42,7 @@ See also \program{ParameterVector2GnssAntennaDefinition}.
 
 #include "programs/program.h"
 #include "base/string.h"
+#include "base/matrixPacked.h"
 #include "files/fileMatrix.h"
 #include "files/fileGnssAntennaDefinition.h"
 #include "files/fileParameterName.h"
@@ -145,7 +146,8 @@ void GnssAntennaNormalsConstraint::run(Config &config)
     // ============================
 
     logStatus<<"read normal equations <"<<fileNameNormalsIn<<">"<<Log::endl;
-    Matrix             normals, rhs;
+    MatrixPacked       normals;
+    Matrix             rhs;
     NormalEquationInfo info;
     readFileNormalEquation(fileNameNormalsIn, info, normals, rhs);
 
@@ -240,6 +242,18 @@ void GnssAntennaNormalsConstraint::run(Config &config)
 
     // ============================
 
+    // normals += c * A1^T A2 at block (idx1, idx2)
+    auto accumulateBlock = [&](Double c, const_MatrixSliceRef A1, const_MatrixSliceRef A2, UInt idx1, UInt idx2)
+    {
+      Matrix N(A1.columns(), A2.columns());
+      matMult(c, A1.trans(), A2, N);
+      for(UInt z=0; z<N.rows(); z++)
+        for(UInt s=((idx1==idx2) ? z : 0); s<N.columns(); s++) // symmetric: both triangles refer to the same element
+          normals(idx1+z, idx2+s) += N(z,s);
+    };
+
+    // ============================
+
     logStatus<<"apply constraints to antennas"<<Log::endl;
     const UInt parameterCount = parametrization->parameterCount();
     for(UInt idAnt=0; idAnt<antennaName.size(); idAnt++)
@@ -253,11 +267,7 @@ void GnssAntennaNormalsConstraint::run(Config &config)
       // weight matrices of each pattern: taken from normal equations
       std::vector<Matrix> P(types.at(idAnt).size());
       for(UInt idType=0; idType<types.at(idAnt).size(); idType++)
-      {
         P.at(idType) = normals.slice(index.at(idAnt).at(idType), index.at(idAnt).at(idType), parameterCount, parameterCount);
-        fillSymmetric(P.at(idType));
-        P.at(idType).setType(Matrix::GENERAL);
-      }
       Matrix I = identityMatrix(parameterCount);
 
       // --- lambda ---------------------
@@ -265,11 +275,8 @@ void GnssAntennaNormalsConstraint::run(Config &config)
       {
         // accumulate constraint normals
         for(UInt idType1=0; idType1<types.at(idAnt).size(); idType1++)
-        {
-          rankKUpdate(weight, A.at(idType1).trans(), normals.slice(index.at(idAnt).at(idType1), index.at(idAnt).at(idType1), parameterCount, parameterCount));
-          for(UInt idType2=idType1+1; idType2<types.at(idAnt).size(); idType2++)
-            matMult(weight, A.at(idType1).trans(), A.at(idType2), normals.slice(index.at(idAnt).at(idType1), index.at(idAnt).at(idType2), parameterCount, parameterCount));
-        }
+          for(UInt idType2=idType1; idType2<types.at(idAnt).size(); idType2++)
+            accumulateBlock(weight, A.at(idType1), A.at(idType2), index.at(idAnt).at(idType1), index.at(idAnt).at(idType2));
         info.observationCount += A.at(0).rows();
       };
       // --------------------------------
@@ -290,7 +297,7 @@ void GnssAntennaNormalsConstraint::run(Config &config)
                 Matrix A = dacv_dcenter.trans() * (constraint.applyWeight ? P.at(idType) : I);
                 triangularSolve(1., N.trans(), A);
                 triangularSolve(1., N,         A);
-                rankKUpdate(1./std::pow(constraint.sigma, 2), A, normals.slice(index.at(idAnt).at(idType), index.at(idAnt).at(idType), parameterCount, parameterCount));
+                accumulateBlock(1./std::pow(constraint.sigma, 2), A, A, index.at(idAnt).at(idType), index.at(idAnt).at(idType));
                 info.observationCount += 3;
               }
             break;
@@ -325,7 +332,7 @@ void GnssAntennaNormalsConstraint::run(Config &config)
                 Double N = inner(dacv_dconst, (constraint.applyWeight ? (P.at(idType)*dacv_dconst) : dacv_dconst));
                 Matrix A = (1./N) * (constraint.applyWeight ? (dacv_dconst.trans()*P.at(idType)) : dacv_dconst.trans());
                 // accumulate constraint normals
-                rankKUpdate(1./std::pow(constraint.sigma, 2), A, normals.slice(index.at(idAnt).at(idType), index.at(idAnt).at(idType), parameterCount, parameterCount));
+                accumulateBlock(1./std::pow(constraint.sigma, 2), A, A, index.at(idAnt).at(idType), index.at(idAnt).at(idType));
                 info.observationCount += 1;
               }
             break;
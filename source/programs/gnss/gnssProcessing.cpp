@@ -1491,6 +1491,8 @@ void GnssProcessing::buildNormals(Gnss::NormalEquationInfo &normalEquationInfo,
     if(!constraintsOnly && (normalEquationInfo.estimationType & ~Gnss::NormalEquationInfo::MASK_CONSTRAINT))
     {
       logStatus<<"- observation equations"<<Log::endl;
+      const MatrixBase::Statistics statistics = MatrixBase::statistics();
+      MatrixBase::PoolScope poolScope; // reuse memory of temporary matrices
       Gnss::DesignMatrix A(normalEquationInfo);
       UInt idLoop     = 0;
       UInt blockCount = 0;
@@ -1576,6 +1578,8 @@ void GnssProcessing::buildNormals(Gnss::NormalEquationInfo &normalEquationInfo,
       } // for(idEpoch)
       Parallel::barrier(normalEquationInfo.comm);
       logTimerLoopEnd(normalEquationInfo.idEpochs.size());
+      const MatrixBase::Statistics stat = MatrixBase::statistics()-statistics;
+      logInfo<<"  matrix allocations: "<<stat.allocations<<" ("<<stat.bytes/1024./1024.%"%.1f MB"s<<"), reused: "<<stat.allocationsPool<<Log::endl;
     } // if(!constraintsOnly)
 
     // other observations and constraints
@@ -61,7 +61,7 @@ public:
   void run(Config &config);
 };
 
-GROOPS_REGISTER_PROGRAM(Gravityfield2EmpiricalCovariance, SINGLEPROCESS, "Estimate a empircal covariance function from time series", Gravityfield, Covariance)
+GROOPS_REGISTER_PROGRAM(Gravityfield2EmpiricalCovariance, PARALLEL, "Estimate a empircal covariance function from time series", Gravityfield, Covariance)
 
 /***********************************************/
 
@@ -117,7 +117,13 @@ void Gravityfield2EmpiricalCovariance::run(Config &config)
     std::vector< std::vector<UInt> > idxC, idxS;
     numbering->numbering(maxDegree, minDegree, idxC, idxS);
     const UInt dim = numbering->parameterCount(maxDegree, minDegree);
-    Matrix CovFull(dim, dim);
+    // auto covariance (delay==0) is symmetric and accumulated in packed storage
+    Matrix       CovFull;
+    MatrixPacked CovPacked;
+    if(delay==0)
+      CovPacked = MatrixPacked(dim);
+    else
+      CovFull = Matrix(dim, dim);
 
     logStatus<<"estimate covariance covariance function in each interval"<<Log::endl;
     UInt countTotal = 0;
@@ -135,52 +141,52 @@ void Gravityfield2EmpiricalCovariance::run(Config &config)
 
       // create time series of potential coefficients
       // --------------------------------------------
+      // coefficients sorted into vectors
+      std::vector<Vector> x(times.size());
+      Parallel::forEach(x, [&](UInt i)
+      {
+        SphericalHarmonics harm = gravityfield->sphericalHarmonics(times.at(i), maxDegree, minDegree, GM, R);
+        const Matrix cnm = harm.cnm();
+        const Matrix snm = harm.snm();
+        Vector xi(dim);
+        for(UInt n=0; n<=std::min(maxDegree, harm.maxDegree()); n++)
+        {
+          if(idxC[n][0]!=NULLINDEX) xi(idxC[n][0]) = cnm(n,0);
+          for(UInt m=1; m<=n; m++)
+          {
+            if(idxC[n][m]!=NULLINDEX) xi(idxC[n][m]) = cnm(n,m);
+            if(idxS[n][m]!=NULLINDEX) xi(idxS[n][m]) = snm(n,m);
+          }
+        }
+        return xi;
+      }, nullptr, FALSE);
+      if(!Parallel::isMaster())
+        continue;
+
       UInt count = times.size();
-      std::vector<SphericalHarmonics> harm(count);
+      Matrix X(dim, count);
       for(UInt i=0; i<count; i++)
-      {
-        harm.at(i) = gravityfield->sphericalHarmonics(times.at(i), maxDegree, minDegree, GM, R);
-        maxDegree = harm.at(i).maxDegree();
-      }
+        copy(x.at(i), X.column(i));
 
       // remove temporal mean
       // --------------------
       if(removeMean)
       {
-        SphericalHarmonics harmMean;
+        Vector mean(dim);
         for(UInt i=0; i<count; i++)
-          harmMean += harm.at(i);
-        harmMean *= 1./count;
+          mean += X.column(i);
+        mean *= 1./count;
         for(UInt i=0; i<count; i++)
-          harm.at(i) -= harmMean;
+          X.column(i) -= mean;
       }
 
       // covariance function
       // -------------------
-      count = harm.size()-delay;
-      for(UInt i=0; i<count; i++)
-      {
-        Matrix cnm1 = harm.at(i).cnm();
-        Matrix snm1 = harm.at(i).snm();
-        Matrix cnm2 = harm.at(i+delay).cnm();
-        Matrix snm2 = harm.at(i+delay).snm();
-        // sort coefficients into vectors
-        Vector x1(dim), x2(dim);
-        for(UInt n=0; n<=maxDegree; n++)
-        {
-          if(idxC[n][0]!=NULLINDEX) x1(idxC[n][0]) = cnm1(n,0);
-          if(idxC[n][0]!=NULLINDEX) x2(idxC[n][0]) = cnm2(n,0);
-          for(UInt m=1; m<=n; m++)
-          {
-            if(idxC[n][m]!=NULLINDEX)  x1(idxC[n][m]) = cnm1(n,m);
-            if(idxC[n][m]!=NULLINDEX)  x2(idxC[n][m]) = cnm2(n,m);
-            if(idxS[n][m]!=NULLINDEX)  x1(idxS[n][m]) = snm1(n,m);
-            if(idxS[n][m]!=NULLINDEX)  x2(idxS[n][m]) = snm2(n,m);
-          }
-        }
-
-        matMult(1., x1, x2.trans(), CovFull);
-      }
+      count = X.columns()-delay;
+      if(delay==0)
+        rankKUpdate(1., X.trans(), CovPacked);
+      else
+        matMult(1., X.column(0, count), X.column(delay, count).trans(), CovFull);
 
       countTotal += count;
       if(removeMean)
@@ -188,36 +194,47 @@ void Gravityfield2EmpiricalCovariance::run(Config &config)
     } // for(idInterval)
     logTimerLoopEnd(timesInterval.size()-1);
 
-    // ============================
+    if(!Parallel::isMaster())
+      return;
 
-    if(delay==0)
-      CovFull.setType(Matrix::SYMMETRIC);
-    CovFull *= 1./countTotal;
-    Matrix Cov = CovFull;
-    Cov *= factorFullMatrix;
+    // ============================
 
-    if(factorIsotropic!=0)
+    // scale in place and add isotropic part to the diagonal
+    auto scale = [&](auto &Cov)
     {
-      Vector kn(maxDegree+1);
-      for(UInt n=0; n<=maxDegree; n++)
+      Vector variance(dim);
+      for(UInt i=0; i<dim; i++)
+        variance(i) = Cov(i,i)/countTotal;
+      Cov *= factorFullMatrix/countTotal;
+
+      if(factorIsotropic!=0)
       {
-        if(idxC[n][0]!=NULLINDEX) kn(n) += CovFull(idxC[n][0],idxC[n][0]);
-        for(UInt m=1; m<=n; m++)
+        Vector kn(maxDegree+1);
+        for(UInt n=0; n<=maxDegree; n++)
         {
-          if(idxC[n][m]!=NULLINDEX) kn(n) += CovFull(idxC[n][m],idxC[n][m]);
-          if(idxS[n][m]!=NULLINDEX) kn(n) += CovFull(idxS[n][m],idxS[n][m]);
+          if(idxC[n][0]!=NULLINDEX) kn(n) += variance(idxC[n][0]);
+          for(UInt m=1; m<=n; m++)
+          {
+            if(idxC[n][m]!=NULLINDEX) kn(n) += variance(idxC[n][m]);
+            if(idxS[n][m]!=NULLINDEX) kn(n) += variance(idxS[n][m]);
+          }
         }
-      }
-      for(UInt n=0; n<=maxDegree; n++)
-      {
-        if(idxC[n][0]!=NULLINDEX) Cov(idxC[n][0],idxC[n][0]) += factorIsotropic * kn(n)/(2*n+1);
-        for(UInt m=1; m<=n; m++)
+        for(UInt n=0; n<=maxDegree; n++)
         {
-          if(idxC[n][m]!=NULLINDEX) Cov(idxC[n][m],idxC[n][m]) += factorIsotropic * kn(n)/(2*n+1);
-          if(idxS[n][m]!=NULLINDEX) Cov(idxS[n][m],idxS[n][m]) += factorIsotropic * kn(n)/(2*n+1);
+          if(idxC[n][0]!=NULLINDEX) Cov(idxC[n][0],idxC[n][0]) += factorIsotropic * kn(n)/(2*n+1);
+          for(UInt m=1; m<=n; m++)
+          {
+            if(idxC[n][m]!=NULLINDEX) Cov(idxC[n][m],idxC[n][m]) += factorIsotropic * kn(n)/(2*n+1);
+            if(idxS[n][m]!=NULLINDEX) Cov(idxS[n][m],idxS[n][m]) += factorIsotropic * kn(n)/(2*n+1);
+          }
         }
       }
-    }
+
+      for(UInt i=0; i<dim; i++)
+        variance(i) = Cov(i,i);
+      return variance;
+    };
+    const Vector variance = (delay==0) ? scale(CovPacked) : scale(CovFull);
 
     // ============================
 
@@ -225,8 +242,9 @@ void Gravityfield2EmpiricalCovariance::run(Config &config)
     // -----
     logStatus << "save covariance matrix to <"<<outputName<<">"<< Log::endl;
     if(delay == 0)
-      Cov.setType(Matrix::SYMMETRIC);
-    writeFileMatrix(outputName, Cov);
+      writeFileMatrix(outputName, CovPacked);
+    else
+      writeFileMatrix(outputName, CovFull);
 
     logInfo<<"  number of fields     : "<<countTotal<<Log::endl;
     logInfo<<"  minDegree            : "<<minDegree<< Log::endl;
@@ -247,14 +265,14 @@ void Gravityfield2EmpiricalCovariance::run(Config &config)
 
       for(UInt n=0; n<=maxDegree; n++)
       {
-        if(idxC[n][0]!=NULLINDEX) cnm(n,0) = sqrt(Cov(idxC[n][0],idxC[n][0]));
-        if(idxC[n][0]!=NULLINDEX) sigma2cnm(n,0) = Cov(idxC[n][0],idxC[n][0]);
+        if(idxC[n][0]!=NULLINDEX) cnm(n,0) = sqrt(variance(idxC[n][0]));
+        if(idxC[n][0]!=NULLINDEX) sigma2cnm(n,0) = variance(idxC[n][0]);
         for(UInt m=1; m<=n; m++)
         {
-          if(idxC[n][m]!=NULLINDEX) cnm(n,m) = sqrt(Cov(idxC[n][m],idxC[n][m]));
-          if(idxS[n][m]!=NULLINDEX) snm(n,m) = sqrt(Cov(idxS[n][m],idxS[n][m]));
-          if(idxC[n][m]!=NULLINDEX) sigma2cnm(n,m) = Cov(idxC[n][m],idxC[n][m]);
-          if(idxS[n][m]!=NULLINDEX) sigma2snm(n,m) = Cov(idxS[n][m],idxS[n][m]);
+          if(idxC[n][m]!=NULLINDEX) cnm(n,m) = sqrt(variance(idxC[n][m]));
+          if(idxS[n][m]!=NULLINDEX) snm(n,m) = sqrt(variance(idxS[n][m]));
+          if(idxC[n][m]!=NULLINDEX) sigma2cnm(n,m) = variance(idxC[n][m]);
+          if(idxS[n][m]!=NULLINDEX) sigma2snm(n,m) = variance(idxS[n][m]);
         }
       }
 
@@ -266,7 +284,7 @@ void Gravityfield2EmpiricalCovariance::run(Config &config)
     try
     {
       if(delay==0)
-        cholesky(Cov);
+        cholesky(CovPacked);
     }
     catch(std::exception &/*e*/)
     {
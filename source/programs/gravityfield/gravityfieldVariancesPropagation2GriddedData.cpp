@@ -70,7 +70,20 @@ void GravityfieldVariancesPropagation2GriddedData::run(Config &config)
     std::vector<Vector3d> points = grid->points();
     std::vector<Double>   areas  = grid->areas();
     std::vector<Double>   field(points.size());
-    Parallel::forEach(field, [&](UInt i) {return sqrt(gravityfield->variance(time, points.at(i), *kernel));});
+
+    // blocks of points are distributed to the processes,
+    // variances() splits them further to limit the memory of the synthesis matrices
+    const UInt blockSize = 1024;
+    std::vector<Vector> sigma2((points.size()+blockSize-1)/blockSize);
+    Parallel::forEach(sigma2, [&](UInt i)
+    {
+      const UInt start = i*blockSize;
+      const UInt count = std::min(blockSize, points.size()-start);
+      return gravityfield->variances(time, std::vector<Vector3d>(points.begin()+start, points.begin()+start+count), *kernel);
+    });
+    for(UInt i=0; i<sigma2.size(); i++)
+      for(UInt k=0; k<sigma2.at(i).rows(); k++)
+        field.at(i*blockSize+k) = std::sqrt(sigma2.at(i)(k));
 
     if(Parallel::isMaster())
     {
@@ -26,6 +26,7 @@ invalid epochs containing NaNs.
 
 /***********************************************/
 
+#include <queue>
 #include "programs/program.h"
 #include "files/fileInstrument.h"
 
@@ -37,6 +38,9 @@ class InstrumentConcatenate
 {
 public:
   void run(Config &config);
+
+private:
+  void concatenateInMemory(const std::vector<FileName> &inName, const FileName &outName, const std::string &choiceRemoveDuplicates, Double margin, Bool checkNaN);
 };
 
 GROOPS_REGISTER_PROGRAM(InstrumentConcatenate, SINGLEPROCESS, "concatenate arcs from several files", Instrument)
@@ -52,7 +56,7 @@ void InstrumentConcatenate::run(Config &config)
     std::vector<FileName> inName;
     Bool                  sort, checkNaN;
     std::string           choiceRemoveDuplicates;
-    Double                margin;
+    Double                margin = 0;
 
     readConfig(config, "outputfile", outName, Config::MUSTSET,  "",  "");
     readConfig(config, "inputfile",  inName,  Config::MUSTSET,  "",  "");
@@ -68,6 +72,200 @@ void InstrumentConcatenate::run(Config &config)
     readConfig(config, "checkForNaNs", checkNaN, Config::DEFAULT,  "0", "remove epochs with NaN values in one of the data fields");
     if(isCreateSchema(config)) return;
 
+    // read times
+    // ----------
+    // only the times of the epochs are kept in memory,
+    // the epochs are read again and written directly to the output file
+    const Bool merge = sort || (choiceRemoveDuplicates == "keepFirst" || choiceRemoveDuplicates == "keepLast");
+    Epoch::Type type = Epoch::EMPTY;
+    Bool isSorted = TRUE;
+    std::vector<FileName>          fileNames;
+    std::vector<std::vector<Time>> times;
+    std::vector<std::vector<Bool>> keep; // FALSE: epoch is removed (NaN or duplicate)
+    for(UInt i=0; i<inName.size(); i++)
+    {
+      std::vector<Time> timesFile;
+      std::vector<Bool> keepFile;
+      Epoch::Type       typeFile;
+      try
+      {
+        logStatus<<"read instrument file <"<<inName.at(i)<<">"<<Log::endl;
+        InstrumentFile file(inName.at(i));
+        for(UInt arcNo=0; arcNo<file.arcCount(); arcNo++)
+          file.readArc(arcNo, [&](const Epoch &epoch)
+          {
+            if(timesFile.size() && (epoch.time < timesFile.back()))
+              isSorted = FALSE;
+            timesFile.push_back(epoch.time);
+            Bool isValid = TRUE;
+            if(checkNaN)
+            {
+              const Vector data = epoch.data();
+              for(UInt j=0; j<data.rows(); j++)
+                if(std::isnan(data.at(j)))
+                  isValid = FALSE;
+            }
+            keepFile.push_back(isValid);
+          });
+        typeFile = file.getType();
+      }
+      catch(std::exception &e)
+      {
+        logWarning<<e.what()<<" continue..."<<Log::endl;
+        continue;
+      }
+
+      if(timesFile.size() && (type != Epoch::EMPTY) && (typeFile != type))
+        throw(Exception("instrument types "+Epoch::getTypeName(type)+" and "+Epoch::getTypeName(typeFile)+" cannot be concatenated"));
+      if(timesFile.size())
+        type = typeFile;
+      fileNames.push_back(inName.at(i));
+      times.push_back(std::move(timesFile));
+      keep.push_back(std::move(keepFile));
+    }
+
+    // files with unsorted epochs cannot be merged while streaming
+    if(merge && !isSorted)
+    {
+      concatenateInMemory(fileNames, outName, choiceRemoveDuplicates, margin, checkNaN);
+      return;
+    }
+
+    // order of the epochs
+    // -------------------
+    // (file, epoch) of the concatenated arc
+    std::vector<std::pair<UInt, UInt>> order;
+    if(merge)
+    {
+      // k-way merge of the sorted files, equal times in the order of the files (as stable sort)
+      logStatus<<"sort epochs"<<Log::endl;
+      auto later = [&](const std::pair<UInt, UInt> &a, const std::pair<UInt, UInt> &b)
+      {
+        const Time &timeA = times.at(a.first).at(a.second);
+        const Time &timeB = times.at(b.first).at(b.second);
+        return (timeB < timeA) || ((timeA == timeB) && (a.first > b.first));
+      };
+      std::priority_queue<std::pair<UInt, UInt>, std::vector<std::pair<UInt, UInt>>, decltype(later)> queue(later);
+      for(UInt k=0; k<times.size(); k++)
+        if(times.at(k).size())
+          queue.push(std::make_pair(k, 0));
+      while(!queue.empty())
+      {
+        auto next = queue.top();
+        queue.pop();
+        order.push_back(next);
+        if(++next.second < times.at(next.first).size())
+          queue.push(next);
+      }
+    }
+    else
+      for(UInt k=0; k<times.size(); k++)
+        for(UInt i=0; i<times.at(k).size(); i++)
+          order.push_back(std::make_pair(k, i));
+
+    // eliminate duplicates
+    // --------------------
+    UInt removedDuplicates = 0;
+    if(choiceRemoveDuplicates == "keepFirst" || choiceRemoveDuplicates == "keepLast")
+    {
+      logStatus<<"eliminate duplicates"<<Log::endl;
+      // same as std::unique: compare with the last kept epoch
+      auto removeDuplicates = [&](auto begin, auto end)
+      {
+        const Time *timeLast = nullptr;
+        for(auto iter=begin; iter!=end; iter++)
+        {
+          const Time &time = times.at(iter->first).at(iter->second);
+          if(timeLast && (std::fabs((time-*timeLast).seconds()) < margin))
+          {
+            keep.at(iter->first).at(iter->second) = FALSE;
+            removedDuplicates++;
+          }
+          else
+            timeLast = &time;
+        }
+      };
+      if(choiceRemoveDuplicates == "keepFirst")
+        removeDuplicates(order.begin(), order.end());
+      else
+        removeDuplicates(order.rbegin(), order.rend());
+      logInfo<<" "<<removedDuplicates<<" duplicates removed!"<<Log::endl;
+    }
+
+    UInt count = 0;
+    for(UInt k=0; k<keep.size(); k++)
+      count += std::count(keep.at(k).begin(), keep.at(k).end(), TRUE);
+
+    // eliminate NaNs
+    // --------------
+    if(checkNaN)
+      logInfo<<" "<<order.size()-count-removedDuplicates<<" epochs with NaN values removed!"<<Log::endl;
+
+    // save
+    // ----
+    logStatus<<"write instrument file <"<<outName<<">"<<Log::endl;
+    std::vector<std::vector<Time>> timesOut(1);
+    // input files are opened when the first epoch is needed and closed after the last arc
+    std::vector<std::unique_ptr<InstrumentFile>> files(fileNames.size());
+    std::vector<Arc>  arcs(fileNames.size());
+    std::vector<UInt> arcNo(fileNames.size(), 0), idxArc(fileNames.size(), 0);
+
+    // in-place update: an input which is also the output must be read completely before the output file is truncated
+    std::vector<std::vector<Arc>> arcsInMemory(fileNames.size());
+    std::vector<Bool> isInMemory(fileNames.size(), FALSE);
+    for(UInt k=0; k<fileNames.size(); k++)
+      if(fileNames.at(k).str() == outName.str())
+      {
+        InstrumentFile file(fileNames.at(k));
+        for(UInt i=0; i<file.arcCount(); i++)
+          arcsInMemory.at(k).push_back(file.readArc(i));
+        isInMemory.at(k) = TRUE;
+      }
+
+    InstrumentFile::Writer writer(outName, type, 1);
+    writer.beginArc(count);
+    for(const auto &index : order)
+    {
+      // next epoch of the file (only the current arc of each file is in memory)
+      const UInt k = index.first;
+      while(idxArc.at(k) >= arcs.at(k).size())
+      {
+        if(isInMemory.at(k))
+          arcs.at(k) = std::move(arcsInMemory.at(k).at(arcNo.at(k)++));
+        else
+        {
+          if(!files.at(k))
+            files.at(k) = std::unique_ptr<InstrumentFile>(new InstrumentFile(fileNames.at(k)));
+          arcs.at(k) = files.at(k)->readArc(arcNo.at(k)++);
+          if(arcNo.at(k) >= files.at(k)->arcCount())
+            files.at(k).reset(); // file exhausted
+        }
+        idxArc.at(k) = 0;
+      }
+      const Epoch &epoch = arcs.at(k).at(idxArc.at(k)++);
+      if(keep.at(k).at(index.second))
+      {
+        writer.writeEpoch(epoch);
+        timesOut.at(0).push_back(epoch.time);
+      }
+    }
+    writer.endArc();
+    writer.close();
+    Arc::printStatistics(timesOut);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// epochs of unsorted files are sorted in memory
+void InstrumentConcatenate::concatenateInMemory(const std::vector<FileName> &inName, const FileName &outName, const std::string &choiceRemoveDuplicates, Double margin, Bool checkNaN)
+{
+  try
+  {
     // read data
     // ---------
     Arc arc;
@@ -87,11 +285,8 @@ void InstrumentConcatenate::run(Config &config)
 
     // sort data
     // ---------
-    if(sort || (choiceRemoveDuplicates == "keepFirst" || choiceRemoveDuplicates == "keepLast"))
-    {
-      logStatus<<"sort epochs"<<Log::endl;
-      arc.sort();
-    }
+    logStatus<<"sort epochs"<<Log::endl;
+    arc.sort();
 
     // eliminate duplicates
     // --------------------
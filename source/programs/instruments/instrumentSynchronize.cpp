@@ -32,6 +32,9 @@ This file can be used for the variational equation approach or \program{KalmanBu
 Instrument files from \config{irregularData} are not synchronized but
 divided into the same number of arcs within the same time intervals.
 Data outside the defined arcs will be deleted.
+
+Only the epoch times are kept in memory. The data are read a second time
+arc by arc and written directly to the output files.
 )";
 
 
@@ -75,6 +78,11 @@ private:
   ArcType           arcType;
   BorderPtr         border;
   UInt              searchInterval(UInt i);
+
+  static std::vector<Time> readTimes(const FileName &fileName, Epoch::Type &type);
+  static std::vector<UInt> synchronizeIndex(const std::vector<Time> &epochTimes, const std::vector<Time> &times, Double margin);
+  static void writeArcs(const FileName &inName, const FileName &outName, const std::vector<UInt> &index,
+                        const std::vector<UInt> &subArcStart, const std::vector<UInt> &subArcLen);
 };
 
 GROOPS_REGISTER_PROGRAM(InstrumentSynchronize, SINGLEPROCESS, "Synchronize instrument data", Instrument)
@@ -138,6 +146,119 @@ UInt InstrumentSynchronize::searchInterval(UInt i)
 
 /***********************************************/
 
+// times of all epochs of a file, without keeping the epochs in memory
+std::vector<Time> InstrumentSynchronize::readTimes(const FileName &fileName, Epoch::Type &type)
+{
+  try
+  {
+    InstrumentFile file(fileName);
+    type = file.getType();
+    std::vector<Time> times;
+    for(UInt arcNo=0; arcNo<file.arcCount(); arcNo++)
+      file.readArc(arcNo, [&](const Epoch &epoch) {times.push_back(epoch.time);});
+    return times;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// index of the epochs kept by Arc::synchronize()
+std::vector<UInt> InstrumentSynchronize::synchronizeIndex(const std::vector<Time> &epochTimes, const std::vector<Time> &times, Double margin)
+{
+  std::vector<UInt> index;
+  UInt idxT=0, idxE=0;
+  for(;;)
+  {
+    if(idxE>=epochTimes.size())
+      break;
+    while((idxT<times.size()) && ((times.at(idxT)-epochTimes.at(idxE)).seconds() < -margin))
+      idxT++;
+    if(idxT>=times.size())
+      break;
+    while((idxE<epochTimes.size()) && ((times.at(idxT)-epochTimes.at(idxE)).seconds() > +margin))
+      idxE++;
+    if(idxE>=epochTimes.size())
+      break;
+    if(std::fabs((times.at(idxT)-epochTimes.at(idxE)).seconds()) > margin)
+      break;
+    index.push_back(idxE++);
+  }
+  return index;
+}
+
+/***********************************************/
+
+// stream the epochs index[subArcStart[i]...subArcStart[i]+subArcLen[i]-1] as arc i into the output file
+void InstrumentSynchronize::writeArcs(const FileName &inName, const FileName &outName, const std::vector<UInt> &index,
+                                      const std::vector<UInt> &subArcStart, const std::vector<UInt> &subArcLen)
+{
+  try
+  {
+    InstrumentFile file(inName);
+    const Epoch::Type type       = file.getType();
+    const UInt        arcCountIn = file.arcCount();
+
+    // in-place update: the input must be read completely before the output file is truncated
+    std::vector<Arc> arcsIn;
+    if(inName.str() == outName.str())
+    {
+      for(UInt arcNoIn=0; arcNoIn<arcCountIn; arcNoIn++)
+        arcsIn.push_back(file.readArc(arcNoIn));
+      file.close();
+    }
+    auto readArc = [&](UInt arcNoIn, const std::function<void(const Epoch &epoch)> &callback)
+    {
+      if(!arcsIn.size())
+        return file.readArc(arcNoIn, callback);
+      for(UInt i=0; i<arcsIn.at(arcNoIn).size(); i++)
+        callback(arcsIn.at(arcNoIn).at(i));
+    };
+
+    InstrumentFile::Writer writer(outName, type, subArcStart.size());
+    UInt idxEpoch = 0; // epoch in input file
+    UInt idx      = 0; // synchronized epoch
+    UInt arcNo    = 0; // output arc
+    Arc  arc(type);
+    auto writeCompleteArcs = [&]()
+    {
+      while((arcNo<subArcStart.size()) && (arc.size() == subArcLen.at(arcNo)))
+      {
+        writer.writeArc(arc);
+        arc = Arc(type);
+        arcNo++;
+      }
+    };
+
+    writeCompleteArcs(); // empty arcs at the beginning
+    for(UInt arcNoIn=0; (arcNoIn<arcCountIn) && (arcNo<subArcStart.size()); arcNoIn++)
+      readArc(arcNoIn, [&](const Epoch &epoch)
+      {
+        if((idx<index.size()) && (index.at(idx) == idxEpoch++))
+        {
+          if((arcNo<subArcStart.size()) && (idx>=subArcStart.at(arcNo)))
+          {
+            arc.push_back(epoch);
+            writeCompleteArcs();
+          }
+          idx++;
+        }
+      });
+    if(arcNo<subArcStart.size())
+      throw(Exception("Length of sub-arc ("+subArcLen.at(arcNo)%"%i) starting at ("s+subArcStart.at(arcNo)%"%i) exceeds arc length ("s+idx%"%i)."s));
+    writer.close();
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
 void InstrumentSynchronize::run(Config &config)
 {
   try
@@ -170,22 +291,25 @@ void InstrumentSynchronize::run(Config &config)
 
     // =============================================
 
-    // read data
-    // ---------
-    std::vector<Arc> arc(data.size());
+    // read times
+    // ----------
+    // the epochs are not kept in memory, they are streamed into the output files afterwards
+    std::vector<std::vector<Time>> timesFile(data.size());
+    std::vector<Epoch::Type>       types(data.size());
     for(UInt k=0; k<data.size(); k++)
     {
       logStatus<<"read instrument file <"<<data.at(k).inName<<">"<<Log::endl;
-      arc.at(k) = InstrumentFile::read(data.at(k).inName);
-      logInfo<<"  epochs = "<<arc.at(k).size()<<Log::endl;
+      timesFile.at(k) = readTimes(data.at(k).inName, types.at(k));
+      logInfo<<"  epochs = "<<timesFile.at(k).size()<<Log::endl;
     }
 
-    std::vector<Arc> arcIrregular(data2.size());
+    std::vector<std::vector<Time>> timesIrregular(data2.size());
     for(UInt k=0; k<data2.size(); k++)
     {
       logStatus<<"read irregular instrument file <"<< data2.at(k).inName<<Log::endl;
-      arcIrregular.at(k) = InstrumentFile::read(data2.at(k).inName);
-      logInfo<<"  epochs = "<<arcIrregular.at(k).size()<<Log::endl;
+      Epoch::Type type;
+      timesIrregular.at(k) = readTimes(data2.at(k).inName, type);
+      logInfo<<"  epochs = "<<timesIrregular.at(k).size()<<Log::endl;
     }
 
     // find orbit data
@@ -193,8 +317,8 @@ void InstrumentSynchronize::run(Config &config)
     UInt indexOrbit = NULLINDEX;
     if(border || (arcType != ALL))
     {
-      for(UInt k=0; k<arc.size(); k++)
-        if(arc.at(k).getType() == Epoch::ORBIT)
+      for(UInt k=0; k<data.size(); k++)
+        if(timesFile.at(k).size() && (types.at(k) == Epoch::ORBIT))
         {
           indexOrbit = k;
           break;
@@ -206,25 +330,25 @@ void InstrumentSynchronize::run(Config &config)
     // synchronize data
     // ----------------
     logStatus<<"synchronize data"<<Log::endl;
-    times.resize(arc.at(0).size());
-    std::vector<UInt> index(arc.size(),0);
-    for(UInt i=0; i<arc.at(0).size(); i++)
+    times.resize(timesFile.at(0).size());
+    std::vector<UInt> index(timesFile.size(),0);
+    for(UInt i=0; i<timesFile.at(0).size(); i++)
     {
-      Time time = arc.at(0).at(i).time;
+      Time time = timesFile.at(0).at(i);
 
       // this point of time in all files?
       Bool synchron = TRUE;
       Bool eof      = FALSE;
-      for(UInt k=1; k<arc.size(); k++)
+      for(UInt k=1; k<timesFile.size(); k++)
       {
-        while(((arc.at(k).at(index.at(k)).time-time).seconds() < -margin) && (++index.at(k)<arc.at(k).size()));
+        while(((timesFile.at(k).at(index.at(k))-time).seconds() < -margin) && (++index.at(k)<timesFile.at(k).size()));
 
-        if(index.at(k)>=arc.at(k).size())
+        if(index.at(k)>=timesFile.at(k).size())
         {
           eof = TRUE;
           break;
         }
-        if(std::fabs((arc.at(k).at(index.at(k)).time-time).seconds()) > margin)
+        if(std::fabs((timesFile.at(k).at(index.at(k))-time).seconds()) > margin)
         {
           synchron = FALSE;
           break;
@@ -245,11 +369,19 @@ void InstrumentSynchronize::run(Config &config)
     // delete other data
     // -----------------
     logStatus<<"delete asynchronize data"<<Log::endl;
-    for(UInt k=0; k<arc.size(); k++)
-      arc.at(k).synchronize(times, margin);
+    std::vector<std::vector<UInt>> indexFile(timesFile.size());
+    for(UInt k=0; k<timesFile.size(); k++)
+    {
+      indexFile.at(k) = synchronizeIndex(timesFile.at(k), times, margin);
+      timesFile.at(k) = std::vector<Time>();
+    }
 
     if(indexOrbit != NULLINDEX)
-      orbitArc = arc.at(indexOrbit);
+    {
+      Arc arc = InstrumentFile::read(data.at(indexOrbit).inName);
+      arc.synchronize(times, margin);
+      orbitArc = arc;
+    }
 
     // divide arcs
     // -----------
@@ -293,10 +425,10 @@ void InstrumentSynchronize::run(Config &config)
       for(UInt k=0; k<data2.size(); k++)
       {
         UInt idx2 = 0;
-        while((idx2<arcIrregular.at(k).size()) && ((arcIrregular.at(k).at(idx2).time-times.at(idxStart)).seconds() < -margin))
+        while((idx2<timesIrregular.at(k).size()) && ((timesIrregular.at(k).at(idx2)-times.at(idxStart)).seconds() < -margin))
           idx2++;
         UInt idx2Start = idx2;
-        while((idx2<arcIrregular.at(k).size()) && ((arcIrregular.at(k).at(idx2).time-times.at(idx-1)).seconds() < +margin))
+        while((idx2<timesIrregular.at(k).size()) && ((timesIrregular.at(k).at(idx2)-times.at(idx-1)).seconds() < +margin))
           idx2++;
         irregularSubArcStart.at(k).push_back(idx2Start);
         irregularSubArcLen.at(k).push_back(idx2-idx2Start);
@@ -340,16 +472,12 @@ void InstrumentSynchronize::run(Config &config)
       writeFileArcList(outArcList, arcsInterval, timesInterval);
     }
 
-    std::vector<Arc> arcList;
     for(UInt k=0; k<data.size(); k++)
     {
       if(!data.at(k).outName.empty())
       {
         logStatus<<"write instrument file <"<<data.at(k).outName<<">"<<Log::endl;
-        arcList.resize(0);
-        for(UInt i=0; i<subArcStart.size(); i++)
-          arcList.push_back( arc.at(k).subArc(subArcStart.at(i), subArcLen.at(i)) );
-        InstrumentFile::write(data.at(k).outName, arcList);
+        writeArcs(data.at(k).inName, data.at(k).outName, indexFile.at(k), subArcStart, subArcLen);
       }
     }
 
@@ -359,14 +487,21 @@ void InstrumentSynchronize::run(Config &config)
       if(!data2.at(k).outName.empty())
       {
         logStatus<<"write irregular instrument file <"<<data2.at(k).outName<<">"<<Log::endl;
-        std::vector<Arc> arcIrregularList;
-        for(UInt i=0; i<irregularSubArcStart.at(k).size(); i++)
-          arcIrregularList.push_back( arcIrregular.at(k).subArc(irregularSubArcStart.at(k).at(i), irregularSubArcLen.at(k).at(i)) );
-        InstrumentFile::write(data2.at(k).outName, arcIrregularList);
+        std::vector<UInt> index(timesIrregular.at(k).size());
+        std::iota(index.begin(), index.end(), 0);
+        writeArcs(data2.at(k).inName, data2.at(k).outName, index, irregularSubArcStart.at(k), irregularSubArcLen.at(k));
       }
     }
 
-    Arc::printStatistics(arcList);
+    if(std::any_of(data.begin(), data.end(), [](const Data &d) {return !d.outName.empty();}))
+    {
+      std::vector<std::vector<Time>> timesList(subArcStart.size());
+      for(UInt i=0; i<subArcStart.size(); i++)
+        timesList.at(i).assign(times.begin()+subArcStart.at(i), times.begin()+subArcStart.at(i)+subArcLen.at(i));
+      Arc::printStatistics(timesList);
+    }
+    else
+      Arc::printStatistics(std::vector<Arc>());
     for(UInt i=1; i<arcsInterval.size(); i++)
       if(arcsInterval.at(i-1) == arcsInterval.at(i))
         logWarning << i<<". intervall ("<<timesInterval.at(i-1).dateTimeStr()<<" - "<<timesInterval.at(i).dateTimeStr()<<") is empty"<<Log::endl;
@@ -16,10 +16,14 @@ This program accumulates normal equations and writes the total combined system t
 \configFile{outputfileNormalequation}{normalEquation}.
 The \configFile{inputfileNormalEquation}{normalEquation}s must have all the same size and the same block structure.
 This program is the simplified and fast version of the more general program \program{NormalsBuild}.
+
+The matrix blocks are distributed over the processes. Each process reads its blocks from all input files
+(the next input block is read in the background while the previous one is added) and writes the sum.
 )";
 
 /***********************************************/
 
+#include <future>
 #include "programs/program.h"
 #include "files/fileMatrix.h"
 #include "files/fileNormalEquation.h"
@@ -34,7 +38,7 @@ public:
   void run(Config &config);
 };
 
-GROOPS_REGISTER_PROGRAM(NormalsAccumulate, SINGLEPROCESS, "accumulate normal equations and write to file", NormalEquation)
+GROOPS_REGISTER_PROGRAM(NormalsAccumulate, PARALLEL, "accumulate normal equations and write to file", NormalEquation)
 
 /***********************************************/
 
@@ -57,89 +61,110 @@ void NormalsAccumulate::run(Config &config)
     logStatus<<"read normal equations info"<<Log::endl;
     Matrix nOut;
     NormalEquationInfo infoOut;
-    std::vector<FileName> fileNameIn;
-    std::vector<Matrix>   usedBlocksIn;
-    for(UInt i=0; i<fileNameInAll.size(); i++)
+    std::vector<UInt>   idxFileIn;
+    std::vector<Matrix> usedBlocksIn;
+    if(Parallel::isMaster())
     {
-      Matrix nIn;
-      NormalEquationInfo infoIn;
-      try
-      {
-        readFileNormalEquation(fileNameInAll.at(i), infoIn, nIn);
-      }
-      catch(std::exception &e)
+      for(UInt i=0; i<fileNameInAll.size(); i++)
       {
-        logWarning<<e.what()<<" continue..."<<Log::endl;
-        continue;
-      }
-
-      fileNameIn.push_back(fileNameInAll.at(i));
-      usedBlocksIn.push_back(infoIn.usedBlocks);
-      if(!infoOut.blockIndex.size())
-      {
-        infoOut = infoIn;
-        nOut    = nIn;
-        continue;
-      }
+        Matrix nIn;
+        NormalEquationInfo infoIn;
+        try
+        {
+          readFileNormalEquation(fileNameInAll.at(i), infoIn, nIn);
+        }
+        catch(std::exception &e)
+        {
+          logWarning<<e.what()<<" continue..."<<Log::endl;
+          continue;
+        }
+
+        idxFileIn.push_back(i);
+        usedBlocksIn.push_back(infoIn.usedBlocks);
+        if(!infoOut.blockIndex.size())
+        {
+          infoOut = infoIn;
+          nOut    = nIn;
+          continue;
+        }
 
-      if(infoOut.blockIndex.size() != infoIn.blockIndex.size())
-        throw(Exception("normals must have the same size and block structure"));
-      for(UInt z=0; z<infoOut.blockIndex.size(); z++)
-        if(infoOut.blockIndex.at(z) != infoIn.blockIndex.at(z))
+        if(infoOut.blockIndex.size() != infoIn.blockIndex.size())
           throw(Exception("normals must have the same size and block structure"));
-      for(UInt z=0; z<infoOut.blockIndex.size()-1; z++)
-        for(UInt s=z; s<infoOut.blockIndex.size()-1; s++)
-          if(infoIn.usedBlocks(z,s))
-            infoOut.usedBlocks(z,s) = 1;
-      for(UInt i=0; i<infoOut.parameterName.size(); i++)
-        if(!infoOut.parameterName.at(i).combine(infoIn.parameterName.at(i)))
-          logWarning << "Parameter names do not match at index " << i << ": '" << infoOut.parameterName.at(i).str() << "' != '" << infoIn.parameterName.at(i).str() << "'" << Log::endl;
-
-      nOut += nIn;
-      infoOut.lPl              += infoIn.lPl;
-      infoOut.observationCount += infoIn.observationCount;
+        for(UInt z=0; z<infoOut.blockIndex.size(); z++)
+          if(infoOut.blockIndex.at(z) != infoIn.blockIndex.at(z))
+            throw(Exception("normals must have the same size and block structure"));
+        for(UInt z=0; z<infoOut.blockIndex.size()-1; z++)
+          for(UInt s=z; s<infoOut.blockIndex.size()-1; s++)
+            if(infoIn.usedBlocks(z,s))
+              infoOut.usedBlocks(z,s) = 1;
+        for(UInt i=0; i<infoOut.parameterName.size(); i++)
+          if(!infoOut.parameterName.at(i).combine(infoIn.parameterName.at(i)))
+            logWarning << "Parameter names do not match at index " << i << ": '" << infoOut.parameterName.at(i).str() << "' != '" << infoIn.parameterName.at(i).str() << "'" << Log::endl;
+
+        nOut += nIn;
+        infoOut.lPl              += infoIn.lPl;
+        infoOut.observationCount += infoIn.observationCount;
+      }
+      if(!idxFileIn.size())
+        throw(Exception("no valid normal equations found"));
     }
+    Parallel::broadCast(idxFileIn);
+    Parallel::broadCast(usedBlocksIn);
+    Parallel::broadCast(infoOut.blockIndex);
+    Parallel::broadCast(infoOut.usedBlocks);
+
+    std::vector<FileName> fileNameIn;
+    for(UInt i : idxFileIn)
+      fileNameIn.push_back(fileNameInAll.at(i));
 
     // ==================================
 
-    logStatus<<"read and write block normals"<<Log::endl;
-    logTimerStart;
-    UInt idx = 0;
+    // list of used blocks
+    std::vector<std::pair<UInt, UInt>> blocks;
     for(UInt z=0; z<infoOut.blockIndex.size()-1; z++)
       for(UInt s=z; s<infoOut.blockIndex.size()-1; s++)
-      {
-        logTimerLoop(idx++, infoOut.blockIndex.size()*(infoOut.blockIndex.size()-1)/2);
-
-        if(infoOut.usedBlocks(z,s) == 0)
-          continue;
+        if(infoOut.usedBlocks(z,s))
+          blocks.push_back(std::make_pair(z, s));
 
-        std::string ext;
-        if(infoOut.blockIndex.size()-1 > 1)
-          ext = "."+z%"%02i-"s+s%"%02i"s;
-
-        Matrix N;
-        logStatus<<"read matrix <"<<fileNameIn.at(0).appendBaseName(ext)<<">"<<Log::endl;
-        for(UInt i=0; i<fileNameIn.size(); i++)
-          if(usedBlocksIn.at(i)(z,s))
-          {
-            logStatus<<"read matrix <"<<fileNameIn.at(i).appendBaseName(ext)<<">"<<Log::endl;
-            Matrix N2;
-            readFileMatrix(fileNameIn.at(i).appendBaseName(ext), N2);
-            if(N.size())
-              N += N2;
-            else
-              N = N2;
-          }
-
-        logStatus<<"write matrix <"<<fileNameOut.appendBaseName(ext)<<">"<<Log::endl;
-        writeFileMatrix(fileNameOut.appendBaseName(ext), N);
+    logStatus<<"read and write block normals"<<Log::endl;
+    Parallel::forEach(blocks.size(), [&](UInt idx)
+    {
+      const UInt z = blocks.at(idx).first;
+      const UInt s = blocks.at(idx).second;
+      std::string ext;
+      if(infoOut.blockIndex.size()-1 > 1)
+        ext = "."+z%"%02i-"s+s%"%02i"s;
+
+      std::vector<FileName> fileNameBlock;
+      for(UInt i=0; i<fileNameIn.size(); i++)
+        if(usedBlocksIn.at(i)(z,s))
+          fileNameBlock.push_back(fileNameIn.at(i).appendBaseName(ext));
+
+      // read next block in background while adding the current one
+      auto readBlock = [](const FileName &fileName) {Matrix N; readFileMatrix(fileName, N); return N;};
+      std::future<Matrix> next = std::async(std::launch::async, readBlock, fileNameBlock.at(0));
+      Matrix N;
+      for(UInt i=0; i<fileNameBlock.size(); i++)
+      {
+        Matrix N2 = next.get();
+        if(i+1 < fileNameBlock.size())
+          next = std::async(std::launch::async, readBlock, fileNameBlock.at(i+1));
+        if(N.size())
+          N += N2;
+        else
+          N = std::move(N2);
       }
-    logTimerLoopEnd(infoOut.blockIndex.size()*(infoOut.blockIndex.size()-1)/2);
+
+      writeFileMatrix(fileNameOut.appendBaseName(ext), N);
+    });
 
     // ==================================
 
-    logStatus<<"write normal equations to <"<<fileNameOut<<">"<<Log::endl;
-    writeFileNormalEquation(fileNameOut, infoOut, nOut);
+    if(Parallel::isMaster())
+    {
+      logStatus<<"write normal equations to <"<<fileNameOut<<">"<<Log::endl;
+      writeFileNormalEquation(fileNameOut, infoOut, nOut);
+    }
   }
   catch(std::exception &e)
   {
@@ -0,0 +1,264 @@
+/***********************************************/
+/**
+* @file normalsAccumulateByName.cpp
+*
+* @brief Accumulate normal equations with different parameters.
+*
+* @date 2026-10-17
+*/
+/***********************************************/
+
+// Latex documentation
+#define DOCSTRING docstring
+static const char *docstring = R"(
+This program accumulates normal equations with different parameter sets and writes the total combined system to
+\configFile{outputfileNormalEquation}{normalEquation}. The parameters are identified by their names.
+In contrast to \program{NormalsAccumulate} the \configFile{inputfileNormalEquation}{normalEquation}s
+need not to have the same size and block structure (e.g. daily GNSS normals with changing stations and satellites).
+
+The parameters of the combined system are given by \configClass{parameterName}{parameterNamesType}.
+Input parameters not contained in this list are ignored.
+Without \configClass{parameterName}{parameterNamesType} the combined system contains all parameters
+of the input normals in the order of their first appearance.
+
+Each input is read in its own block structure and each block is sent to the processes holding
+the corresponding blocks of the combined system, where it is added in continuous ranges of parameters (scatter-add).
+Only blocks of the combined system which get contributions are allocated, so no reordered full size copies
+of the inputs are needed. The parameter names within each input must be unique.
+The combined system is divided into blocks of \config{outBlockSize}.
+)";
+
+/***********************************************/
+
+#include "programs/program.h"
+#include "classes/parameterNames/parameterNames.h"
+#include "parallel/matrixDistributed.h"
+#include "files/fileNormalEquation.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Accumulate normal equations with different parameters.
+* @ingroup programsGroup */
+class NormalsAccumulateByName
+{
+public:
+  void run(Config &config);
+};
+
+GROOPS_REGISTER_PROGRAM(NormalsAccumulateByName, PARALLEL, "accumulate normal equations with different parameters identified by names", NormalEquation)
+
+/***********************************************/
+
+void NormalsAccumulateByName::run(Config &config)
+{
+  try
+  {
+    FileName              fileNameOut;
+    std::vector<FileName> fileNameIn;
+    ParameterNamesPtr     parameterNames;
+    UInt                  blockSize;
+
+    readConfig(config, "outputfileNormalEquation", fileNameOut,    Config::MUSTSET,  "",     "");
+    readConfig(config, "inputfileNormalEquation",  fileNameIn,     Config::MUSTSET,  "",     "");
+    readConfig(config, "parameterName",            parameterNames, Config::OPTIONAL, "",     "parameters of the combined system (default: all input parameters)");
+    readConfig(config, "outBlockSize",             blockSize,      Config::DEFAULT,  "2048", "block size for distributing the normal equations, 0: one block");
+    if(isCreateSchema(config)) return;
+
+    // ==================================
+
+    logStatus<<"read normal equations info"<<Log::endl;
+    std::vector<NormalEquationInfo> infoIn(fileNameIn.size());
+    std::vector<Matrix>             nIn(fileNameIn.size());
+    for(UInt idFile=0; idFile<fileNameIn.size(); idFile++)
+      readFileNormalEquation(fileNameIn.at(idFile), infoIn.at(idFile), nIn.at(idFile));
+
+    // parameters of combined system
+    NormalEquationInfo info;
+    const Bool isFixed = (parameterNames != nullptr);
+    if(isFixed)
+      info.parameterName = parameterNames->parameterNames();
+    std::unordered_map<ParameterName, UInt, ParameterName::Hash> nameIndex;
+    for(UInt i=0; i<info.parameterName.size(); i++)
+      if(!nameIndex.emplace(info.parameterName.at(i), i).second)
+        throw(Exception("parameter <"+info.parameterName.at(i).str()+"> of the combined system is not unique"));
+
+    // index of input parameters in the combined system
+    std::vector<std::vector<UInt>> index(fileNameIn.size());
+    for(UInt idFile=0; idFile<fileNameIn.size(); idFile++)
+    {
+      try
+      {
+        ParameterNameIndex(infoIn.at(idFile).parameterName, TRUE/*unique*/);
+      }
+      catch(std::exception &e)
+      {
+        GROOPS_RETHROW_EXTRA(fileNameIn.at(idFile).str(), e)
+      }
+
+      UInt countIgnored = 0;
+      for(const auto &name : infoIn.at(idFile).parameterName)
+      {
+        auto iter = nameIndex.find(name);
+        if((iter == nameIndex.end()) && !isFixed)
+        {
+          iter = nameIndex.emplace(name, info.parameterName.size()).first;
+          info.parameterName.push_back(name);
+        }
+        index.at(idFile).push_back((iter != nameIndex.end()) ? iter->second : NULLINDEX);
+        if(iter == nameIndex.end())
+          countIgnored++;
+      }
+      if(countIgnored && Parallel::isMaster())
+        logWarning<<fileNameIn.at(idFile)<<": "<<countIgnored<<" parameters not in the combined system are ignored"<<Log::endl;
+    }
+    logInfo<<"  number of parameters:       "<<info.parameterName.size()<<Log::endl;
+
+    // ==================================
+
+    // right hand sides
+    const UInt rhsCount = nIn.at(0).columns();
+    Matrix n(info.parameterName.size(), rhsCount);
+    info.lPl = Vector(rhsCount);
+    info.observationCount = 0;
+    if(Parallel::isMaster())
+      for(UInt idFile=0; idFile<fileNameIn.size(); idFile++)
+      {
+        if(nIn.at(idFile).columns() != rhsCount)
+          throw(Exception(fileNameIn.at(idFile).str()+": number of right hand sides must agree ("+nIn.at(idFile).columns()%"%i != "s+rhsCount%"%i)"s));
+        for(UInt i=0; i<index.at(idFile).size(); i++)
+          if(index.at(idFile).at(i) != NULLINDEX)
+            n.row(index.at(idFile).at(i)) += nIn.at(idFile).row(i);
+        info.lPl              += infoIn.at(idFile).lPl;
+        info.observationCount += infoIn.at(idFile).observationCount;
+      }
+    nIn.clear();
+
+    // ==================================
+
+    // continuous ranges of input parameters within one block of the combined system
+    // -----------------------------------------------------------------------------
+    class Range
+    {
+    public:
+      UInt start, count; // within input block
+      UInt block, index; // block of combined system and start within it
+    };
+
+    MatrixDistributed normals;
+    normals.initEmpty(MatrixDistributed::computeBlockIndex(info.parameterName.size(), blockSize));
+    std::vector<std::vector<std::vector<Range>>> ranges(fileNameIn.size()); // for each file, input block
+    for(UInt idFile=0; idFile<fileNameIn.size(); idFile++)
+    {
+      const std::vector<UInt> &blockIndex = infoIn.at(idFile).blockIndex;
+      ranges.at(idFile).resize(blockIndex.size()-1);
+      for(UInt i=0; i+1<blockIndex.size(); i++)
+        for(UInt z=blockIndex.at(i); z<blockIndex.at(i+1); z++)
+        {
+          const UInt row = index.at(idFile).at(z);
+          if(row == NULLINDEX)
+            continue;
+          std::vector<Range> &list = ranges.at(idFile).at(i);
+          if(list.size() && (list.back().start+list.back().count == z-blockIndex.at(i)) &&
+             (row < normals.blockIndex(list.back().block+1)) && (normals.blockIndex(list.back().block)+list.back().index+list.back().count == row))
+            list.back().count++;
+          else
+          {
+            const UInt block = normals.index2block(row);
+            list.push_back(Range{z-blockIndex.at(i), 1, block, row-normals.blockIndex(block)});
+          }
+        }
+    }
+
+    // block structure of combined system: only blocks with contributions
+    // ------------------------------------------------------------------
+    std::set<std::pair<UInt, UInt>> usedBlocks;
+    for(UInt idFile=0; idFile<fileNameIn.size(); idFile++)
+    {
+      const Matrix &used = infoIn.at(idFile).usedBlocks;
+      for(UInt i=0; i<ranges.at(idFile).size(); i++)
+        for(UInt k=i; k<ranges.at(idFile).size(); k++)
+          if(!used.size() || (used(i,k) > 0))
+            for(const Range &r1 : ranges.at(idFile).at(i))
+              for(const Range &r2 : ranges.at(idFile).at(k))
+                usedBlocks.insert(std::make_pair(std::min(r1.block, r2.block), std::max(r1.block, r2.block)));
+    }
+    for(const auto &block : usedBlocks)
+      normals.setBlock(block.first, block.second);
+    logInfo<<"  used blocks:                "<<usedBlocks.size()<<" of "<<normals.blockCount()*(normals.blockCount()+1)/2<<Log::endl;
+
+    // ==================================
+
+    logStatus<<"accumulate normal equations"<<Log::endl;
+    logTimerStart;
+    for(UInt idFile=0; idFile<fileNameIn.size(); idFile++)
+    {
+      logTimerLoop(idFile, fileNameIn.size());
+
+      NormalEquationInfo infoTmp;
+      MatrixDistributed  normalsIn;
+      Matrix             nTmp;
+      readFileNormalEquation(fileNameIn.at(idFile), infoTmp, normalsIn, nTmp);
+
+      for(UInt i=0; i<normalsIn.blockCount(); i++)
+        for(UInt k=i; k<normalsIn.blockCount(); k++)
+        {
+          if(!normalsIn.isBlockUsed(i, k))
+            continue;
+
+          // send input block to the processes holding the target blocks
+          std::set<UInt> ranks;
+          for(const Range &r1 : ranges.at(idFile).at(i))
+            for(const Range &r2 : ranges.at(idFile).at(k))
+              ranks.insert(normals.rank(std::min(r1.block, r2.block), std::max(r1.block, r2.block)));
+          Matrix N;
+          if(normalsIn.isMyRank(i, k))
+          {
+            std::swap(N, normalsIn.N(i,k));
+            for(UInt rank : ranks)
+              if(rank != Parallel::myRank())
+                Parallel::send(N, rank);
+          }
+          else if(ranks.count(Parallel::myRank()))
+            Parallel::receive(N, normalsIn.rank(i, k));
+          if(!ranks.count(Parallel::myRank()))
+            continue;
+
+          // add ranges to owned target blocks
+          for(const Range &r1 : ranges.at(idFile).at(i))
+            for(const Range &r2 : ranges.at(idFile).at(k))
+            {
+              if((i == k) && (r2.start < r1.start)) // lower triangle of diagonal block
+                continue;
+              const Bool isTrans = (r1.block > r2.block) || ((r1.block == r2.block) && (r1.index > r2.index)); // target in lower triangle?
+              const UInt I = std::min(r1.block, r2.block);
+              const UInt K = std::max(r1.block, r2.block);
+              if(!normals.isMyRank(I, K))
+                continue;
+              Matrix &Nout = normals.N(I,K);
+              if((i == k) && (r1.start == r2.start)) // diagonal: upper triangle only
+              {
+                for(UInt s=0; s<r1.count; s++)
+                  axpy(1., N.slice(r1.start, r1.start+s, s+1, 1), Nout.slice(r1.index, r1.index+s, s+1, 1));
+              }
+              else if(isTrans)
+                axpy(1., N.slice(r1.start, r2.start, r1.count, r2.count), Nout.trans().slice(r1.index, r2.index, r1.count, r2.count));
+              else
+                axpy(1., N.slice(r1.start, r2.start, r1.count, r2.count), Nout.slice(r1.index, r2.index, r1.count, r2.count));
+            }
+        }
+    }
+    Parallel::barrier();
+    logTimerLoopEnd(fileNameIn.size());
+
+    // ==================================
+
+    logStatus<<"write normal equations to <"<<fileNameOut<<">"<<Log::endl;
+    writeFileNormalEquation(fileNameOut, info, normals, n);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
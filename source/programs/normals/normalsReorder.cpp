@@ -20,6 +20,11 @@ Without \configClass{parameterSelection}{parameterSelectorType} the order of par
 Additionally the block sizes of the files can be adjusted. If \config{outBlockSize} is set to zero,
 the normal matrix is written to a single block file, which is needed by some programs.
 
+With \config{fillReducingBlockOrder} the blocks of the reordered normals are additionally permuted
+by a minimum degree ordering of the block structure. This reduces the fill-in blocks and the number of operations
+of the Cholesky decomposition for sparse block structures (e.g. arc or epoch parameters).
+The predicted memory and operations of the decomposition are reported for the original, the new and a dense block structure.
+
 To eliminate parameters without changing the result of the other parameters use \program{NormalsEliminate}.
 )";
 
@@ -52,6 +57,7 @@ void NormalsReorder::run(Config &config)
     FileName outName, inName;
     ParameterSelectorPtr parameterSelector;
     UInt     blockSize;
+    Bool     fillReducing;
 
     renameDeprecatedConfig(config, "outputfileNormalequation", "outputfileNormalEquation", date2time(2020, 6, 3));
     renameDeprecatedConfig(config, "inputfileNormalequation",  "inputfileNormalEquation",  date2time(2020, 6, 3));
@@ -60,6 +66,7 @@ void NormalsReorder::run(Config &config)
     readConfig(config, "inputfileNormalEquation",  inName,            Config::MUSTSET,  "", "");
     readConfig(config, "parameterSelection",       parameterSelector, Config::OPTIONAL, "",     "parameter order/selection of output normal equations");
     readConfig(config, "outBlockSize",             blockSize,         Config::DEFAULT,   "2048", "block size for distributing the normal equations, 0: one block");
+    readConfig(config, "fillReducingBlockOrder",   fillReducing,      Config::DEFAULT,   "0",    "permute the blocks to reduce the fill-in of the cholesky decomposition");
     if(isCreateSchema(config)) return;
 
     // ==================================
@@ -82,6 +89,26 @@ void NormalsReorder::run(Config &config)
 
     logStatus<<"reorder normal matrix"<<Log::endl;
     normal.reorder(indexVector, MatrixDistributed::computeBlockIndex(indexVector.size(), blockSize));
+
+    if(fillReducing)
+    {
+      logStatus<<"fill-reducing block order"<<Log::endl;
+      const std::vector<UInt> order = normal.minimumDegreeBlockOrder();
+      Double elements, flops;
+      UInt blocks = normal.symbolicCholesky({}, TRUE, elements, flops);
+      logInfo<<"  cholesky (dense):    "<<blocks%"%5i blocks, "s<<elements*sizeof(Double)/1024/1024%"%10.1f MB, "s<<flops%"%.2e flops"s<<Log::endl;
+      blocks = normal.symbolicCholesky({}, FALSE, elements, flops);
+      logInfo<<"  cholesky (original): "<<blocks%"%5i blocks, "s<<elements*sizeof(Double)/1024/1024%"%10.1f MB, "s<<flops%"%.2e flops"s<<Log::endl;
+      blocks = normal.symbolicCholesky(order, FALSE, elements, flops);
+      logInfo<<"  cholesky (reordered):"<<blocks%"%5i blocks, "s<<elements*sizeof(Double)/1024/1024%"%10.1f MB, "s<<flops%"%.2e flops"s<<Log::endl;
+
+      const std::vector<UInt> indexBlocks = normal.reorderBlocks(order);
+      std::vector<UInt> indexTmp(indexBlocks.size());
+      for(UInt i=0; i<indexBlocks.size(); i++)
+        indexTmp.at(i) = indexVector.at(indexBlocks.at(i));
+      std::swap(indexTmp, indexVector);
+    }
+
     rhs = reorder(rhs, indexVector);
     std::vector<ParameterName> parameterNames(indexVector.size());
     for(UInt i = 0; i < indexVector.size(); i++)
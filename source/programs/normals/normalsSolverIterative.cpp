@@ -0,0 +1,580 @@
+/***********************************************/
+/**
+* @file normalsSolverIterative.cpp
+*
+* @brief Solve observation equations with preconditioned conjugate gradients.
+* The normal matrix is never assembled.
+*
+* @date 2026-10-17
+*/
+/***********************************************/
+
+// Latex documentation
+#define DOCSTRING docstring
+static const char *docstring = R"(
+This program solves the least squares adjustment of \configClass{observation}{observationType}
+with the preconditioned conjugate gradient (PCG) method. In contrast to \program{NormalsSolverVCE}
+the normal matrix is never assembled. Only the products of the normal matrix with vectors are computed
+arc by arc from the design matrices
+\begin{equation}
+\M N\M p = \sum_{arcs} \M A_i^T(\M A_i\M p),
+\end{equation}
+so the memory requirement is of the order of the number of parameters. This allows the estimation
+of very high resolution gravity fields where the normal matrix is too large even for
+distributed memory.
+
+The arc related parameters are eliminated in each arc. The resulting observation equations of the arcs can be stored in
+\config{cacheDirectory} after the first pass and are read in all further iterations instead of being recomputed.
+The arcs are distributed over the processes in the first pass and each process computes the same arcs in all iterations.
+
+The preconditioner is the block diagonal part of the normal matrix. The blocks are derived from the parameter names:
+the spherical harmonics coefficients of the same order (\verb|sphericalHarmonics.c_n_m|, \verb|sphericalHarmonics.s_n_m|)
+form one block independent of the numbering (see \configClass{parametrizationGravity}{parametrizationGravityType}),
+which approximates the dominant order-wise structure of the normal matrix.
+All other parameters are grouped in consecutive order.
+Blocks larger than \config{preconditionerBlockSize} are split.
+
+An optional diagonal regularization (\configFile{inputfileDiagonalMatrix}{matrix}) can be added.
+In this case the relative weighting between the observations and the regularization is determined iteratively by means
+of variance component estimation (VCE). The redundancies are estimated with \config{monteCarloSampleCount} random vectors
+$\M z$ which are solved together with the right hand sides in the same PCG iteration,
+\begin{equation}
+r_k = n_k - \frac{1}{\sigma_k^2}\M z^T\M N_k\M N^{-1}\M z.
+\end{equation}
+The estimated variance factors can be saved in \configFile{outputfileVarianceFactors}{matrix}.
+)";
+
+/***********************************************/
+
+#include "programs/program.h"
+#include "files/fileMatrix.h"
+#include "misc/varianceComponentEstimation.h"
+#include "classes/observation/observation.h"
+
+/***** CLASS ***********************************/
+
+/** @brief Solve observation equations with preconditioned conjugate gradients.
+* The normal matrix is never assembled.
+* @ingroup programsGroup */
+class NormalsSolverIterative
+{
+  ObservationPtr      observation;
+  FileName            cacheDirectory;
+  std::vector<UInt>   processNo;
+  std::vector<Bool>   isEmptyArc;
+  std::vector<Double> ePeArc2;  // additional residuals of orthogonal transformed arcs
+  std::vector<std::vector<UInt>> blockIndex; // parameter indices of the preconditioner blocks
+  std::vector<Matrix> N;        // block diagonal of normal matrix (observations, unweighted)
+  std::vector<Matrix> W;        // cholesky decomposition of preconditioner
+  Vector              diagonal; // regularization
+  Double              sigma2Obs, sigma2Reg;
+
+  Matrix designMatrix(UInt arcNo, Matrix &l, Matrix &l2);
+  void   observationEquations(UInt arcNo, Matrix &l, Matrix &A); // from cache or recomputed
+  Matrix multiply(const Matrix &P);              // observations only, unweighted
+  Double residualNorm(const_MatrixSliceRef x, UInt rhsNo);
+  Matrix multiplyWeighted(const Matrix &P);      // all components, weighted
+  void   initBlocks(UInt blockSize);
+  void   initPreconditioner();
+  Matrix preconditioning(const_MatrixSliceRef E);
+  UInt   conjugateGradient(const_MatrixSliceRef B, Matrix &X, Double tolerance, UInt maxIter);
+
+public:
+  void run(Config &config);
+};
+
+GROOPS_REGISTER_PROGRAM(NormalsSolverIterative, PARALLEL, "solve observation equations with preconditioned conjugate gradients (PCG) without normal matrix", NormalEquation)
+
+/***********************************************/
+
+void NormalsSolverIterative::run(Config &config)
+{
+  try
+  {
+    FileName fileNameSolution, fileNameVarianceFactors;
+    FileName fileNameDiagonal;
+    Double   sigmaObs, sigmaReg;
+    UInt     rhsNo, blockSize, sampleCount;
+    UInt     maxIter, maxIterVCE;
+    Double   tolerance;
+
+    readConfig(config, "outputfileSolution",         fileNameSolution,        Config::OPTIONAL, "",      "parameter vector");
+    readConfig(config, "outputfileVarianceFactors",  fileNameVarianceFactors, Config::OPTIONAL, "",      "estimated variance factors as vector");
+    readConfig(config, "observation",                observation,             Config::MUSTSET,  "",      "");
+    readConfig(config, "aprioriSigma",               sigmaObs,                Config::DEFAULT,  "1.0",   "of observations");
+    readConfig(config, "inputfileDiagonalMatrix",    fileNameDiagonal,        Config::OPTIONAL, "",      "Vector with the diagonal elements of the regularization weight matrix");
+    readConfig(config, "aprioriSigmaRegularization", sigmaReg,                Config::DEFAULT,  "1.0",   "");
+    readConfig(config, "cacheDirectory",             cacheDirectory,          Config::OPTIONAL, "",      "observation equations of the arcs are stored here after the first pass");
+    readConfig(config, "rightHandSideNumberVCE",     rhsNo,                   Config::DEFAULT,  "0",     "the right hand side number for estimation of variance factors");
+    readConfig(config, "preconditionerBlockSize",    blockSize,               Config::DEFAULT,  "512",   "max. size of the preconditioner blocks (blocks per order are split)");
+    readConfig(config, "monteCarloSampleCount",      sampleCount,             Config::DEFAULT,  "100",   "number of random vectors for the estimation of redundancies (VCE)");
+    readConfig(config, "tolerance",                  tolerance,               Config::DEFAULT,  "1e-10", "relative norm of residuals (N*x-n) to stop PCG iteration");
+    readConfig(config, "maxIterationCount",          maxIter,                 Config::DEFAULT,  "1000",  "maximum number of PCG iterations");
+    readConfig(config, "maxIterationCountVCE",       maxIterVCE,              Config::DEFAULT,  "20",    "maximum number of iterations for variance component estimation");
+    if(isCreateSchema(config)) return;
+
+    const UInt paraCount = observation->parameterCount();
+    const UInt rhsCount  = observation->rightSideCount();
+    logInfo<<"  number of unknown parameters: "<<paraCount<<Log::endl;
+    logInfo<<"  number of right hand sides:   "<<rhsCount<<Log::endl;
+    if(rhsNo >= rhsCount)
+      throw(Exception("rightHandSideNumberVCE exceeds number of right hand sides"));
+
+    if(!fileNameDiagonal.empty())
+    {
+      readFileMatrix(fileNameDiagonal, diagonal);
+      if(diagonal.rows() != paraCount)
+        throw(Exception("regularization matrix must have the dimension of the parameters ("+diagonal.rows()%"%i != "s+paraCount%"%i)"s));
+    }
+    else
+      sampleCount = 0; // only one variance component -> no Monte Carlo needed
+    sigma2Obs = sigmaObs*sigmaObs;
+    sigma2Reg = sigmaReg*sigmaReg;
+
+    initBlocks(std::max(blockSize, UInt(1)));
+    logInfo<<"  number of preconditioner blocks: "<<blockIndex.size()<<Log::endl;
+
+    // random vectors for Monte Carlo estimation of redundancies
+    Matrix Z;
+    if(Parallel::isMaster() && sampleCount)
+      Z = Vce::monteCarlo(paraCount, sampleCount);
+    Parallel::broadCast(Z);
+
+    // ==================================
+
+    // first pass: right hand side, block diagonal, and N*z
+    // ----------------------------------------------------
+    logStatus<<"compute observation equations"<<Log::endl;
+    Matrix n(paraCount, rhsCount);
+    UInt   obsCount = 0;
+    Matrix NZ(paraCount, sampleCount);
+    N.resize(blockIndex.size());
+    for(UInt i=0; i<blockIndex.size(); i++)
+      N.at(i) = Matrix(blockIndex.at(i).size(), Matrix::SYMMETRIC);
+    isEmptyArc.resize(observation->arcCount(), TRUE);
+    ePeArc2.resize(observation->arcCount(), 0.);
+    processNo = Parallel::forEach(observation->arcCount(), [&](UInt arcNo)
+    {
+      Matrix l, l2;
+      const Matrix A = designMatrix(arcNo, l, l2);
+      if(!A.size())
+        return;
+      isEmptyArc.at(arcNo) = FALSE;
+      ePeArc2.at(arcNo)    = quadsum(l2.column(rhsNo));
+      if(!cacheDirectory.empty())
+      {
+        Matrix lA(A.rows(), l.columns()+A.columns());
+        copy(l, lA.column(0, l.columns()));
+        copy(A, lA.column(l.columns(), A.columns()));
+        writeFileMatrix(cacheDirectory.append("arc"+arcNo%"%06i.dat"s), lA);
+      }
+
+      matMult(1., A.trans(), l, n);
+      obsCount += l.rows() + l2.rows();
+      for(UInt i=0; i<blockIndex.size(); i++)
+      {
+        Matrix Ai(A.rows(), blockIndex.at(i).size());
+        for(UInt k=0; k<blockIndex.at(i).size(); k++)
+          copy(A.column(blockIndex.at(i).at(k)), Ai.column(k));
+        rankKUpdate(1., Ai, N.at(i));
+      }
+      if(sampleCount)
+        matMult(1., A.trans(), A*Z, NZ);
+    });
+    Parallel::broadCast(processNo);
+    Parallel::reduceSum(n);
+    Parallel::reduceSum(obsCount);
+    Parallel::reduceSum(NZ);
+    for(UInt i=0; i<blockIndex.size(); i++)
+      Parallel::reduceSum(N.at(i));
+    if(!Parallel::isMaster())
+      N.clear();
+    logInfo<<"  number of observations: "<<obsCount<<Log::endl;
+
+    // ==================================
+
+    Matrix x(paraCount, rhsCount);
+    Matrix Y(paraCount, sampleCount);
+    for(UInt iter=0; iter<maxIterVCE; iter++)
+    {
+      if(Parallel::isMaster() && diagonal.size())
+        logInfo<<"  variance factors: observations = "<<std::sqrt(sigma2Obs)<<", regularization = "<<std::sqrt(sigma2Reg)<<Log::endl;
+
+      // solve N*[x, Y] = [n, Z]
+      // -----------------------
+      logStatus<<"solve normal equations (PCG)"<<Log::endl;
+      initPreconditioner();
+      Matrix B(paraCount, rhsCount+sampleCount);
+      Matrix X(paraCount, rhsCount+sampleCount);
+      if(Parallel::isMaster())
+      {
+        axpy(1./sigma2Obs, n, B.column(0, rhsCount));
+        copy(x, X.column(0, rhsCount)); // warm start
+        if(sampleCount)
+        {
+          copy(Z, B.column(rhsCount, sampleCount));
+          copy(Y, X.column(rhsCount, sampleCount));
+        }
+      }
+      const UInt iterCount = conjugateGradient(B, X, tolerance, maxIter);
+      logInfo<<"  PCG iterations: "<<iterCount<<Log::endl;
+      if(Parallel::isMaster())
+      {
+        x = X.column(0, rhsCount);
+        if(sampleCount)
+          Y = X.column(rhsCount, sampleCount);
+      }
+
+      // variance component estimation
+      // -----------------------------
+      const Double ePeObs = residualNorm(x.column(rhsNo), rhsNo); // all processes
+      UInt ready = TRUE;
+      if(Parallel::isMaster())
+      {
+        Double rObs = obsCount - paraCount;
+        if(sampleCount)
+          rObs = obsCount - inner(NZ, Y)/sigma2Obs;
+        const Double sigma2ObsOld = sigma2Obs;
+        sigma2Obs = ePeObs/rObs;
+        ready = (std::fabs(std::sqrt(sigma2Obs)-std::sqrt(sigma2ObsOld))/std::sqrt(sigma2Obs) < 0.01);
+
+        if(diagonal.size())
+        {
+          Double ePeReg = 0, rReg = 0;
+          for(UInt i=0; i<diagonal.rows(); i++)
+            if(diagonal(i))
+            {
+              ePeReg += diagonal(i) * std::pow(x(i, rhsNo), 2);
+              rReg   += 1. - diagonal(i) * inner(Z.row(i), Y.row(i))/sigma2Reg;
+            }
+          const Double sigma2RegOld = sigma2Reg;
+          sigma2Reg = ePeReg/rReg;
+          ready = ready && (std::fabs(std::sqrt(sigma2Reg)-std::sqrt(sigma2RegOld))/std::sqrt(sigma2Reg) < 0.01);
+        }
+        logInfo<<"  sigma (observations) = "<<std::sqrt(sigma2Obs)<<Log::endl;
+      }
+      Parallel::broadCast(sigma2Obs);
+      Parallel::broadCast(sigma2Reg);
+      Parallel::broadCast(ready);
+
+      if(Parallel::isMaster() && !fileNameSolution.empty())
+      {
+        logStatus<<"write solution to <"<<fileNameSolution<<">"<<Log::endl;
+        writeFileMatrix(fileNameSolution, x);
+      }
+
+      if(!diagonal.size() || ready)
+        break;
+    } // for(iter)
+
+    if(Parallel::isMaster() && !fileNameVarianceFactors.empty())
+    {
+      logStatus<<"write variance factors to <"<<fileNameVarianceFactors<<">"<<Log::endl;
+      Vector sigmas(diagonal.size() ? 2 : 1);
+      sigmas(0) = std::sqrt(sigma2Obs);
+      if(diagonal.size())
+        sigmas(1) = std::sqrt(sigma2Reg);
+      writeFileMatrix(fileNameVarianceFactors, sigmas);
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// decorrelated design matrix with eliminated arc related parameters
+Matrix NormalsSolverIterative::designMatrix(UInt arcNo, Matrix &l, Matrix &l2)
+{
+  try
+  {
+    Matrix A, B;
+    observation->observation(arcNo, l, A, B);
+    if(l.rows()==0)
+      return Matrix();
+
+    // if equations are orthogonal transformed
+    // additional residuals appended to l
+    if(l.rows()>A.rows())
+    {
+      l2 = l.row(A.rows(), l.rows()-A.rows());
+      l  = l.row(0, A.rows());
+    }
+
+    // eliminate arc related parameters
+    if(B.size())
+      eliminationParameter(B, A, l);
+    return A;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void NormalsSolverIterative::observationEquations(UInt arcNo, Matrix &l, Matrix &A)
+{
+  try
+  {
+    if(cacheDirectory.empty())
+    {
+      Matrix l2;
+      A = designMatrix(arcNo, l, l2);
+      return;
+    }
+
+    Matrix lA;
+    readFileMatrix(cacheDirectory.append("arc"+arcNo%"%06i.dat"s), lA);
+    const UInt rhsCount = observation->rightSideCount();
+    l = lA.column(0, rhsCount);
+    A = lA.column(rhsCount, lA.columns()-rhsCount);
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix NormalsSolverIterative::multiply(const Matrix &P)
+{
+  try
+  {
+    Matrix P2 = P;
+    Parallel::broadCast(P2);
+    Matrix Q(P2.rows(), P2.columns());
+    Parallel::forEachProcess(isEmptyArc.size(), [&](UInt arcNo)
+    {
+      if(isEmptyArc.at(arcNo))
+        return;
+      Matrix l, A;
+      observationEquations(arcNo, l, A);
+      matMult(1., A.trans(), A*P2, Q);
+    }, processNo, nullptr, FALSE/*timing*/);
+    Parallel::reduceSum(Q);
+    return Q;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// weighted norm of residuals, valid at master
+Double NormalsSolverIterative::residualNorm(const_MatrixSliceRef x, UInt rhsNo)
+{
+  try
+  {
+    Vector x2 = x;
+    Parallel::broadCast(x2);
+    Double ePe = 0;
+    Parallel::forEachProcess(isEmptyArc.size(), [&](UInt arcNo)
+    {
+      if(isEmptyArc.at(arcNo))
+        return;
+      Matrix l, A;
+      observationEquations(arcNo, l, A);
+      ePe += quadsum(l.column(rhsNo) - A*x2) + ePeArc2.at(arcNo);
+    }, processNo, nullptr, FALSE/*timing*/);
+    Parallel::reduceSum(ePe);
+    return ePe;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix NormalsSolverIterative::multiplyWeighted(const Matrix &P)
+{
+  try
+  {
+    Matrix Q = multiply(P);
+    if(Parallel::isMaster())
+    {
+      Q *= 1./sigma2Obs;
+      for(UInt i=0; i<diagonal.rows(); i++)
+        axpy(diagonal(i)/sigma2Reg, P.row(i), Q.row(i));
+    }
+    return Q;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// spherical harmonics coefficients of the same order in one block, other parameters in consecutive order
+void NormalsSolverIterative::initBlocks(UInt blockSize)
+{
+  try
+  {
+    std::vector<ParameterName> names;
+    observation->parameterName(names);
+
+    const std::string prefix = "sphericalHarmonics.";
+    std::map<std::string, UInt> openBlock; // group -> block which is filled
+    blockIndex.clear();
+    for(UInt i=0; i<observation->parameterCount(); i++)
+    {
+      std::string group; // empty: other parameters
+      if((i < names.size()) && (names.at(i).type.compare(0, prefix.size(), prefix) == 0))
+      {
+        const std::string &type = names.at(i).type; // c_n_m or s_n_m
+        group = names.at(i).object+ParameterName::sep+names.at(i).temporal+ParameterName::sep+names.at(i).interval+ParameterName::sep+type.substr(type.rfind('_')+1);
+      }
+      auto iter = openBlock.find(group);
+      if((iter == openBlock.end()) || (blockIndex.at(iter->second).size() >= blockSize))
+      {
+        openBlock[group] = blockIndex.size();
+        blockIndex.push_back({});
+      }
+      blockIndex.at(openBlock[group]).push_back(i);
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+void NormalsSolverIterative::initPreconditioner()
+{
+  try
+  {
+    if(!Parallel::isMaster())
+      return;
+    W.resize(N.size());
+    for(UInt i=0; i<N.size(); i++)
+    {
+      W.at(i) = (1./sigma2Obs) * N.at(i);
+      for(UInt k=0; k<W.at(i).rows(); k++)
+      {
+        if(diagonal.size())
+          W.at(i)(k,k) += diagonal(blockIndex.at(i).at(k))/sigma2Reg;
+        if(W.at(i)(k,k) == 0.)
+          W.at(i)(k,k) = 1.; // not used parameter
+      }
+      cholesky(W.at(i));
+    }
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+Matrix NormalsSolverIterative::preconditioning(const_MatrixSliceRef E)
+{
+  try
+  {
+    Matrix Z(E.rows(), E.columns());
+    for(UInt i=0; i<W.size(); i++)
+    {
+      Matrix Zi(blockIndex.at(i).size(), E.columns());
+      for(UInt k=0; k<blockIndex.at(i).size(); k++)
+        copy(E.row(blockIndex.at(i).at(k)), Zi.row(k));
+      triangularSolve(1., W.at(i).trans(), Zi);
+      triangularSolve(1., W.at(i), Zi);
+      for(UInt k=0; k<blockIndex.at(i).size(); k++)
+        copy(Zi.row(k), Z.row(blockIndex.at(i).at(k)));
+    }
+    return Z;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
+
+// each column is solved independently, input and output valid at master
+UInt NormalsSolverIterative::conjugateGradient(const_MatrixSliceRef B, Matrix &X, Double tolerance, UInt maxIter)
+{
+  try
+  {
+    const UInt count = B.columns();
+    Matrix E = multiplyWeighted(X);
+    Matrix P;
+    Vector rz(count), normB(count);
+    if(Parallel::isMaster())
+    {
+      E = B - E;
+      P = preconditioning(E);
+      for(UInt k=0; k<count; k++)
+      {
+        rz(k)    = inner(E.column(k), P.column(k));
+        normB(k) = std::max(norm(B.column(k)), 1e-300);
+      }
+    }
+
+    UInt iter = 0;
+    for(; iter<maxIter; iter++)
+    {
+      // check convergence
+      UInt converged = TRUE;
+      if(Parallel::isMaster())
+      {
+        Double maxResidual = 0;
+        for(UInt k=0; k<count; k++)
+          maxResidual = std::max(maxResidual, norm(E.column(k))/normB(k));
+        converged = (maxResidual <= tolerance);
+        if((iter % 50 == 0) || converged)
+          logInfo<<"  "<<iter%"%4i"s<<". PCG iteration: max. relative residual = "<<maxResidual%"%.2e"s<<Log::endl;
+      }
+      Parallel::broadCast(converged);
+      if(converged)
+        break;
+
+      const Matrix Q = multiplyWeighted(P);
+      if(Parallel::isMaster())
+      {
+        for(UInt k=0; k<count; k++)
+        {
+          const Double pq = inner(P.column(k), Q.column(k));
+          if(pq <= 0)
+            continue; // column converged
+          const Double alpha = rz(k)/pq;
+          axpy( alpha, P.column(k), X.column(k));
+          axpy(-alpha, Q.column(k), E.column(k));
+        }
+
+        const Matrix Z = preconditioning(E);
+        for(UInt k=0; k<count; k++)
+        {
+          const Double rzNew = inner(E.column(k), Z.column(k));
+          const Double beta  = (rz(k) > 0) ? rzNew/rz(k) : 0.;
+          rz(k) = rzNew;
+          P.column(k) *= beta;
+          axpy(1., Z.column(k), P.column(k));
+        }
+      }
+    }
+
+    if(Parallel::isMaster() && (iter >= maxIter))
+      logWarning<<"PCG not converged after "<<maxIter<<" iterations"<<Log::endl;
+    return iter;
+  }
+  catch(std::exception &e)
+  {
+    GROOPS_RETHROW(e)
+  }
+}
+
+/***********************************************/
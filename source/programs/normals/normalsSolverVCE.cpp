@@ -31,6 +31,16 @@ parameter and columns for each \configClass{normalEquation}{normalEquationType}
 and indicates the contribution of the individual normals to the estimated parameters.
 Each row sum up to one.
 
+With \config{mixedPrecision} the Cholesky decomposition is computed in single precision
+and the solution is refined iteratively in double precision until the relative change
+is below \config{mixedPrecision:tolerance}. The normal matrix is kept in double precision
+for the residuals of the refinement and the single precision factor (including fill-in) is held in addition,
+so the peak memory is about 1.5 times that of the double precision decomposition.
+If the refinement does not converge within \config{mixedPrecision:maxIterationCount} iterations,
+the decomposition is recomputed in double precision. Otherwise the variance factors and the accuracies
+(\configFile{outputfileSigmax}{matrix}, \configFile{outputfileCovariance}{matrix})
+are derived from the single precision decomposition.
+
 See also \program{NormalsBuild}.
 )";
 
@@ -67,6 +77,10 @@ void NormalsSolverVCE::run(Config &config)
     UInt              rhsNo;
     UInt              maxIter;
     UInt              blockSize;
+    Bool              mixedPrecision = FALSE;
+    Double            refinementTolerance = 1e-12;
+    UInt              refinementMaxIter = 10;
+    Bool              refinementTiming = TRUE;
 
     renameDeprecatedConfig(config, "outputfileNormalequation", "outputfileNormalEquation", date2time(2020, 6, 3));
     renameDeprecatedConfig(config, "normalequation",           "normalEquation",           date2time(2020, 6, 3));
@@ -82,6 +96,14 @@ void NormalsSolverVCE::run(Config &config)
     readConfig(config, "rightHandSideNumberVCE",    rhsNo,                   Config::DEFAULT,  "0",    "the right hand side number for estimation of variance factors");
     readConfig(config, "normalsBlockSize",          blockSize,               Config::DEFAULT,  "2048", "block size for distributing the normal equations, 0: one block");
     readConfig(config, "maxIterationCount",         maxIter,                 Config::DEFAULT,  "20",   "maximum number of iterations for variance component estimation");
+    if(readConfigSequence(config, "mixedPrecision", Config::OPTIONAL, "", "cholesky decomposition in single precision with iterative refinement of the solution"))
+    {
+      mixedPrecision = TRUE;
+      readConfig(config, "tolerance",         refinementTolerance, Config::DEFAULT, "1e-12", "max. relative change of the solution to stop the iterative refinement");
+      readConfig(config, "maxIterationCount", refinementMaxIter,   Config::DEFAULT, "10",    "max. number of refinement steps, afterwards double precision decomposition");
+      readConfig(config, "timing",            refinementTiming,    Config::DEFAULT, "1",     "log timing of the decomposition and the refinement steps");
+      endSequence(config);
+    }
     if(isCreateSchema(config)) return;
 
     logStatus<<"init normal equations"<<Log::endl;
@@ -142,7 +164,7 @@ void NormalsSolverVCE::run(Config &config)
       }
 
       logStatus<<"solve normal equations"<<Log::endl;
-      Matrix x = normals->solve();
+      Matrix x = normals->solve(mixedPrecision, refinementTolerance, refinementMaxIter, refinementTiming);
       logInfo<<"  sigma (total) = "<<normals->aposterioriSigma()<<Log::endl;
 
       if(Parallel::isMaster() && !fileNameSolution.empty())
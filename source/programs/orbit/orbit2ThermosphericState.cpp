@@ -75,20 +75,28 @@ void Orbit2ThermosphericState::run(Config &config)
     Parallel::forEach(arcList, [&] (UInt arcNo)
     {
       const OrbitArc orbit = orbitFile.readArc(arcNo);
+      const std::vector<Time> times = orbit.times();
+      std::vector<Rotary3d> rotEarth(orbit.size());
+      std::vector<Vector3d> posEarth(orbit.size());
+      for(UInt i=0; i<orbit.size(); i++)
+      {
+        rotEarth.at(i) = earthRotation->rotaryMatrix(times.at(i));
+        posEarth.at(i) = rotEarth.at(i).rotate(orbit.at(i).position);
+      }
+
+      std::vector<Double>   density, temperature;
+      std::vector<Vector3d> wind;
+      thermosphere->state(times, posEarth, density, temperature, wind);
+
       Matrix A(orbit.size(), dataCount);
       for(UInt i=0; i<orbit.size(); i++)
       {
-        const Rotary3d rotEarth = earthRotation->rotaryMatrix(orbit.at(i).time);
-        Double   density, temperature;
-        Vector3d wind;
-        thermosphere->state(orbit.at(i).time, rotEarth.rotate(orbit.at(i).position), density, temperature, wind);
-        wind = rotEarth.inverseRotate(wind) + crossProduct(earthRotation->rotaryAxis(orbit.at(i).time), orbit.at(i).position);
-
-        A(i, 1) = density;
-        A(i, 2) = temperature;
-        A(i, 3) = wind.x();
-        A(i, 4) = wind.y();
-        A(i, 5) = wind.z();
+        wind.at(i) = rotEarth.at(i).inverseRotate(wind.at(i)) + crossProduct(earthRotation->rotaryAxis(times.at(i)), orbit.at(i).position);
+        A(i, 1) = density.at(i);
+        A(i, 2) = temperature.at(i);
+        A(i, 3) = wind.at(i).x();
+        A(i, 4) = wind.at(i).y();
+        A(i, 5) = wind.at(i).z();
       }
 
       UInt idx = 6;
@@ -129,6 +129,16 @@ void PlotGraph::run(Config &config)
       logInfo<<"  plot z range  ("<<colorbar->getMin()<<" .. "<<colorbar->getMax()<<") of ("<<minZ<<" .. "<<maxZ<<")"<<Log::endl;
     }
 
+    // reduce data to figure resolution
+    // --------------------------------
+    const UInt pixelX = static_cast<UInt>(std::ceil(std::fabs(plotBasics.width) /2.54*plotBasics.dpi));
+    const UInt pixelY = std::isnan(plotBasics.height) ? 0 : static_cast<UInt>(std::ceil(std::fabs(plotBasics.height)/2.54*plotBasics.dpi));
+    for(UInt i=0; i<layer.size(); i++)
+    {
+      PlotAxisPtr axis = (axisY2 && layer.at(i)->drawOnSecondAxis()) ? axisY2 : axisY;
+      layer.at(i)->decimate(axisX->isLogarithmic(), axisX->getMin(), axisX->getMax(), pixelX, axis->isLogarithmic(), axis->getMin(), axis->getMax(), pixelY);
+    }
+
     // create data files
     // -----------------
     logStatus<<"create temporary data files"<<Log::endl;
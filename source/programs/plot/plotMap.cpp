@@ -141,6 +141,13 @@ void PlotMap::run(Config &config)
         plotBasics.height = (maxB-minB)/(maxL-minL) * plotBasics.width;
     }
 
+    // reduce data to figure resolution
+    // --------------------------------
+    const UInt pixelX = static_cast<UInt>(std::ceil(plotBasics.width /2.54*plotBasics.dpi));
+    const UInt pixelY = static_cast<UInt>(std::ceil(plotBasics.height/2.54*plotBasics.dpi));
+    for(UInt i=0; i<layer.size(); i++)
+      layer.at(i)->decimate(ellipsoid, minL, maxL, minB, maxB, pixelX, pixelY);
+
     // create data files
     // -----------------
     logStatus<<"create temporary data files"<<Log::endl;
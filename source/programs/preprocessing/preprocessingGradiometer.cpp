@@ -216,17 +216,24 @@ GradiometerArc PreprocessingGradiometer::computeArc(UInt arcNo)
       Arc::checkSynchronized({orbit, reference.at(k)});
     }
 
+    const std::vector<Time> times = orbit.times();
+    std::vector<Rotary3d> rotEarth(epochCount);
+    std::vector<Vector3d> posEarth(epochCount);
     for(UInt i=0; i<epochCount; i++)
     {
-      const Time     time     = orbit.at(i).time;
-      const Rotary3d rotEarth = earthRotation->rotaryMatrix(time);
-      const Vector3d posEarth = rotEarth.rotate(orbit.at(i).position);
+      rotEarth.at(i) = earthRotation->rotaryMatrix(times.at(i));
+      posEarth.at(i) = rotEarth.at(i).rotate(orbit.at(i).position);
+    }
+    // referencefield for all epochs at once
+    const std::vector<Tensor3d> gradient = rhs->referencefield->gravityGradient(times, posEarth);
 
+    for(UInt i=0; i<epochCount; i++)
+    {
       // referencefield + tides
-      const Tensor3d tns = rhs->referencefield->gravityGradient(time, posEarth)
-                          + rhs->tides->gradient(time, posEarth, rotEarth, earthRotation, ephemerides);
+      const Tensor3d tns = gradient.at(i)
+                          + rhs->tides->gradient(times.at(i), posEarth.at(i), rotEarth.at(i), earthRotation, ephemerides);
       // observed minus computed
-      sggArc.at(i).gravityGradient -= starCamera.at(i).rotary.inverseRotate(rotEarth.inverseRotate(tns));
+      sggArc.at(i).gravityGradient -= starCamera.at(i).rotary.inverseRotate(rotEarth.at(i).inverseRotate(tns));
       // gradients from files
       for(UInt k=0; k<reference.size(); k++)
         sggArc.at(i).gravityGradient -= reference.at(k).at(i).gravityGradient;
@@ -249,7 +256,6 @@ GradiometerArc PreprocessingGradiometer::computeArc(UInt arcNo)
 
     // gradiometer bias for each component
     // -----------------------------------
-    const std::vector<Time> times = orbit.times();
     sggBias->setInterval(times.front(), times.back()+medianSampling(times), TRUE);
     if(sggBias->parameterCount())
     {
@@ -76,21 +76,29 @@ void SimulateGradiometer::run(Config &config)
       StarCameraArc starCamera = starCameraFile.readArc(arcNo);
       Arc::checkSynchronized({orbit, starCamera});
 
+      const std::vector<Time> times = orbit.times();
+      std::vector<Rotary3d> rotEarth(orbit.size());
+      std::vector<Vector3d> posEarth(orbit.size());
+      for(UInt k=0; k<orbit.size(); k++)
+      {
+        rotEarth.at(k) = earthRotation->rotaryMatrix(times.at(k));
+        posEarth.at(k) = rotEarth.at(k).rotate(orbit.at(k).position);
+      }
+      const std::vector<Tensor3d> gradient = gravityfield->gravityGradient(times, posEarth);
+
       GradiometerArc gradiometer;
       for(UInt k=0; k<orbit.size(); k++)
       {
         Rotary3d rotSat;
         if(starCamera.size())
           rotSat = starCamera.at(k).rotary;
-        const Time     time     = orbit.at(k).time;
-        const Rotary3d rotEarth = earthRotation->rotaryMatrix(time);
-        const Vector3d posEarth = rotEarth.rotate(orbit.at(k).position);
-        const Tensor3d tns      = gravityfield->gravityGradient(time, posEarth)
-                                + tides->gradient(time, posEarth, rotEarth, earthRotation, ephemerides);
+        const Time     time = times.at(k);
+        const Tensor3d tns  = gradient.at(k)
+                            + tides->gradient(time, posEarth.at(k), rotEarth.at(k), earthRotation, ephemerides);
 
         GradiometerEpoch epoch;
         epoch.time            = time;
-        epoch.gravityGradient = rotSat.inverseRotate(rotEarth.inverseRotate(tns));
+        epoch.gravityGradient = rotSat.inverseRotate(rotEarth.at(k).inverseRotate(tns));
         gradiometer.push_back(epoch);
       }
       return gradiometer;